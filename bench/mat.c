@@ -0,0 +1,258 @@
+/*  Microbenchmark for the matrix kernels in src/mat.c, compared against
+ *  the original scalar implementations (which are also used to check
+ *  the results).  Run with make bench-mat. */
+#include "platform.h"
+#include "mat.h"
+
+#define BENCH_ITERS 2000000
+#define BENCH_POINTS 4096
+#define BENCH_POINT_ITERS 1000
+
+/*  The reference functions used to live in their own translation unit,
+ *  so keep them out of line to make the comparison fair */
+#define BENCH_NOINLINE __attribute__((noinline))
+
+BENCH_NOINLINE
+static mat4_t ref_mul(const mat4_t a, const mat4_t b) {
+    mat4_t out;
+    for (unsigned i=0; i < 4; ++i) {
+        for (unsigned j=0; j < 4; ++j) {
+            out.m[i][j] = 0.0f;
+            for (unsigned k=0; k < 4; ++k) {
+                out.m[i][j] += a.m[i][k] * b.m[k][j];
+            }
+        }
+    }
+    return out;
+}
+
+BENCH_NOINLINE
+static vec3_t ref_apply(const mat4_t m, const vec3_t v) {
+    float w[4] = {v.v[0], v.v[1], v.v[2], 1.0f};
+    float o[4] = {0.0f};
+    for (unsigned i=0; i < 4; ++i) {
+        for (unsigned j=0; j < 4; ++j) {
+            o[i] += m.m[j][i] * w[j];
+        }
+    }
+    vec3_t out;
+    for (unsigned k=0; k < 3; ++k) {
+        out.v[k] = o[k] / o[3];
+    }
+    return out;
+}
+
+/*  The original cofactor-expansion inverse */
+BENCH_NOINLINE
+static mat4_t ref_inv(const mat4_t in) {
+   const float a00 = in.m[0][0];
+   const float a01 = in.m[0][1];
+   const float a02 = in.m[0][2];
+   const float a03 = in.m[0][3];
+   const float a10 = in.m[1][0];
+   const float a11 = in.m[1][1];
+   const float a12 = in.m[1][2];
+   const float a13 = in.m[1][3];
+   const float a20 = in.m[2][0];
+   const float a21 = in.m[2][1];
+   const float a22 = in.m[2][2];
+   const float a23 = in.m[2][3];
+   const float a30 = in.m[3][0];
+   const float a31 = in.m[3][1];
+   const float a32 = in.m[3][2];
+   const float a33 = in.m[3][3];
+
+   const float det = a00*a11*a22*a33 + a00*a12*a23*a31 + a00*a13*a21*a32
+                   + a01*a10*a23*a32 + a01*a12*a20*a33 + a01*a13*a22*a30
+                   + a02*a10*a21*a33 + a02*a11*a23*a30 + a02*a13*a20*a31
+                   + a03*a10*a22*a31 + a03*a11*a20*a32 + a03*a12*a21*a30
+                   - a00*a11*a23*a32 - a00*a12*a21*a33 - a00*a13*a22*a31
+                   - a01*a10*a22*a33 - a01*a12*a23*a30 - a01*a13*a20*a32
+                   - a02*a10*a23*a31 - a02*a11*a20*a33 - a02*a13*a21*a30
+                   - a03*a10*a21*a32 - a03*a11*a22*a30 - a03*a12*a20*a31;
+
+   if (det == 0.0f) {
+       return mat4_identity();
+   }
+
+   mat4_t out;
+   out.m[0][0] = a11*a22*a33 + a12*a23*a31 + a13*a21*a32
+               - a11*a23*a32 - a12*a21*a33 - a13*a22*a31;
+   out.m[0][1] = a01*a23*a32 + a02*a21*a33 + a03*a22*a31
+               - a01*a22*a33 - a02*a23*a31 - a03*a21*a32;
+   out.m[0][2] = a01*a12*a33 + a02*a13*a31 + a03*a11*a32
+               - a01*a13*a32 - a02*a11*a33 - a03*a12*a31;
+   out.m[0][3] = a01*a13*a22 + a02*a11*a23 + a03*a12*a21
+               - a01*a12*a23 - a02*a13*a21 - a03*a11*a22;
+   out.m[1][0] = a10*a23*a32 + a12*a20*a33 + a13*a22*a30
+               - a10*a22*a33 - a12*a23*a30 - a13*a20*a32;
+   out.m[1][1] = a00*a22*a33 + a02*a23*a30 + a03*a20*a32
+               - a00*a23*a32 - a02*a20*a33 - a03*a22*a30;
+   out.m[1][2] = a00*a13*a32 + a02*a10*a33 + a03*a12*a30
+               - a00*a12*a33 - a02*a13*a30 - a03*a10*a32;
+   out.m[1][3] = a00*a12*a23 + a02*a13*a20 + a03*a10*a22
+               - a00*a13*a22 - a02*a10*a23 - a03*a12*a20;
+   out.m[2][0] = a10*a21*a33 + a11*a23*a30 + a13*a20*a31
+               - a10*a23*a31 - a11*a20*a33 - a13*a21*a30;
+   out.m[2][1] = a00*a23*a31 + a01*a20*a33 + a03*a21*a30
+               - a00*a21*a33 - a01*a23*a30 - a03*a20*a31;
+   out.m[2][2] = a00*a11*a33 + a01*a13*a30 + a03*a10*a31
+               - a00*a13*a31 - a01*a10*a33 - a03*a11*a30;
+   out.m[2][3] = a00*a13*a21 + a01*a10*a23 + a03*a11*a20
+               - a00*a11*a23 - a01*a13*a20 - a03*a10*a21;
+   out.m[3][0] = a10*a22*a31 + a11*a20*a32 + a12*a21*a30
+               - a10*a21*a32 - a11*a22*a30 - a12*a20*a31;
+   out.m[3][1] = a00*a21*a32 + a01*a22*a30 + a02*a20*a31
+               - a00*a22*a31 - a01*a20*a32 - a02*a21*a30;
+   out.m[3][2] = a00*a12*a31 + a01*a10*a32 + a02*a11*a30
+               - a00*a11*a32 - a01*a12*a30 - a02*a10*a31;
+   out.m[3][3] = a00*a11*a22 + a01*a12*a20 + a02*a10*a21
+               - a00*a12*a21 - a01*a10*a22 - a02*a11*a20;
+
+   for (unsigned i=0; i < 4; ++i) {
+       for (unsigned j=0; j < 4; ++j) {
+           out.m[i][j] /= det;
+       }
+   }
+   return out;
+}
+
+static float rand_float(void) {
+    return rand() / (float)RAND_MAX * 2.0f - 1.0f;
+}
+
+static mat4_t rand_mat(void) {
+    mat4_t m;
+    for (unsigned i=0; i < 4; ++i) {
+        for (unsigned j=0; j < 4; ++j) {
+            m.m[i][j] = rand_float() + (i == j ? 4.0f : 0.0f);
+        }
+    }
+    return m;
+}
+
+static float mat_diff(const mat4_t* a, const mat4_t* b) {
+    float d = 0.0f;
+    for (unsigned i=0; i < 4; ++i) {
+        for (unsigned j=0; j < 4; ++j) {
+            d = fmaxf(d, fabsf(a->m[i][j] - b->m[i][j]));
+        }
+    }
+    return d;
+}
+
+static float vec_diff(const vec3_t* a, const vec3_t* b) {
+    float d = 0.0f;
+    for (unsigned i=0; i < 3; ++i) {
+        d = fmaxf(d, fabsf(a->v[i] - b->v[i]));
+    }
+    return d;
+}
+
+static void report(const char* name, int64_t ref_ns, int64_t new_ns,
+                   unsigned count, float err)
+{
+    printf("%-10s %8.2f ns -> %8.2f ns  (%.2fx, max error %g)\n", name,
+           ref_ns / (double)count, new_ns / (double)count,
+           ref_ns / (double)new_ns, err);
+}
+
+int main(void) {
+    srand(1);
+    mat4_t ms[64];
+    for (unsigned i=0; i < 64; ++i) {
+        ms[i] = rand_mat();
+    }
+
+    /*  Accumulate into a sink, so that loops aren't optimized out */
+    volatile float sink = 0.0f;
+    float err = 0.0f;
+
+    {   /* mat4_mul */
+        int64_t t0 = platform_get_time_ns();
+        for (unsigned i=0; i < BENCH_ITERS; ++i) {
+            const mat4_t m = ref_mul(ms[i % 64], ms[(i + 1) % 64]);
+            sink += m.m[i % 4][0];
+        }
+        int64_t t1 = platform_get_time_ns();
+        for (unsigned i=0; i < BENCH_ITERS; ++i) {
+            const mat4_t m = mat4_mul(&ms[i % 64], &ms[(i + 1) % 64]);
+            sink += m.m[i % 4][0];
+        }
+        int64_t t2 = platform_get_time_ns();
+        for (unsigned i=0; i < 64; ++i) {
+            const mat4_t a = ref_mul(ms[i], ms[(i + 1) % 64]);
+            const mat4_t b = mat4_mul(&ms[i], &ms[(i + 1) % 64]);
+            err = fmaxf(err, mat_diff(&a, &b));
+        }
+        report("mat4_mul", t1 - t0, t2 - t1, BENCH_ITERS, err);
+    }
+
+    {   /* mat4_inv */
+        err = 0.0f;
+        int64_t t0 = platform_get_time_ns();
+        for (unsigned i=0; i < BENCH_ITERS; ++i) {
+            const mat4_t m = ref_inv(ms[i % 64]);
+            sink += m.m[i % 4][0];
+        }
+        int64_t t1 = platform_get_time_ns();
+        for (unsigned i=0; i < BENCH_ITERS; ++i) {
+            const mat4_t m = mat4_inv(&ms[i % 64]);
+            sink += m.m[i % 4][0];
+        }
+        int64_t t2 = platform_get_time_ns();
+        for (unsigned i=0; i < 64; ++i) {
+            const mat4_t a = ref_inv(ms[i]);
+            const mat4_t b = mat4_inv(&ms[i]);
+            err = fmaxf(err, mat_diff(&a, &b));
+        }
+        report("mat4_inv", t1 - t0, t2 - t1, BENCH_ITERS, err);
+    }
+
+    {   /* mat4_apply and mat4_apply_n */
+        static vec3_t in[BENCH_POINTS];
+        static vec3_t out[BENCH_POINTS];
+        static vec3_t ref[BENCH_POINTS];
+        for (unsigned i=0; i < BENCH_POINTS; ++i) {
+            in[i] = (vec3_t){{rand_float(), rand_float(), rand_float()}};
+        }
+        const mat4_t m = ms[0];
+
+        int64_t t0 = platform_get_time_ns();
+        for (unsigned j=0; j < BENCH_POINT_ITERS; ++j) {
+            for (unsigned i=0; i < BENCH_POINTS; ++i) {
+                ref[i] = ref_apply(m, in[i]);
+            }
+            sink += ref[j % BENCH_POINTS].v[0];
+        }
+        int64_t t1 = platform_get_time_ns();
+        for (unsigned j=0; j < BENCH_POINT_ITERS; ++j) {
+            for (unsigned i=0; i < BENCH_POINTS; ++i) {
+                out[i] = mat4_apply(&m, in[i]);
+            }
+            sink += out[j % BENCH_POINTS].v[0];
+        }
+        int64_t t2 = platform_get_time_ns();
+        err = 0.0f;
+        for (unsigned i=0; i < BENCH_POINTS; ++i) {
+            err = fmaxf(err, vec_diff(&ref[i], &out[i]));
+        }
+        report("mat4_apply", t1 - t0, t2 - t1,
+               BENCH_POINTS * BENCH_POINT_ITERS, err);
+
+        const int64_t ref_ns = t1 - t0;
+        t1 = platform_get_time_ns();
+        for (unsigned j=0; j < BENCH_POINT_ITERS; ++j) {
+            mat4_apply_n(&m, in, out, BENCH_POINTS);
+            sink += out[j % BENCH_POINTS].v[0];
+        }
+        t2 = platform_get_time_ns();
+        err = 0.0f;
+        for (unsigned i=0; i < BENCH_POINTS; ++i) {
+            err = fmaxf(err, vec_diff(&ref[i], &out[i]));
+        }
+        report("apply_n", ref_ns, t2 - t1,
+               BENCH_POINTS * BENCH_POINT_ITERS, err);
+    }
+    return 0;
+}
@@ -0,0 +1,195 @@
+/*  Load generator for the quiz daemon.  Each client thread opens its own
+ *  connection and acts like a kiosk:  it asks for the next item for a
+ *  random profile, then grades it, timing every round trip.  Prints
+ *  throughput and latency percentiles when done. */
+#include <errno.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "log.h"
+#include "platform.h"
+#include "protocol.h"
+
+typedef struct {
+    const char* socket_path;
+    uint32_t profiles;
+    unsigned requests;
+    uint32_t seed;
+
+    /*  Round-trip times in nanoseconds, one per request */
+    int64_t* latencies;
+    unsigned count;
+    unsigned errors;
+} load_client_t;
+
+/*  xorshift32, which is plenty for picking profiles and grades */
+static uint32_t load_rand(uint32_t* state) {
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *state = x;
+}
+
+static bool load_send_all(int fd, const void* data, size_t size) {
+    const uint8_t* ptr = data;
+    while (size) {
+        const ssize_t n = write(fd, ptr, size);
+        if (n < 0 && errno != EINTR) {
+            return false;
+        } else if (n > 0) {
+            ptr += n;
+            size -= n;
+        }
+    }
+    return true;
+}
+
+static bool load_recv_all(int fd, void* data, size_t size) {
+    uint8_t* ptr = data;
+    while (size) {
+        const ssize_t n = read(fd, ptr, size);
+        if (n == 0 || (n < 0 && errno != EINTR)) {
+            return false;
+        } else if (n > 0) {
+            ptr += n;
+            size -= n;
+        }
+    }
+    return true;
+}
+
+/*  Sends a request and waits for its response, recording the latency */
+static bool load_call(load_client_t* c, int fd, smd_request_t* r,
+                      smd_response_t* out)
+{
+    r->seq = c->count;
+    const int64_t start = platform_get_time_ns();
+    if (!load_send_all(fd, r, sizeof(*r)) ||
+        !load_recv_all(fd, out, sizeof(*out)))
+    {
+        return false;
+    }
+    c->latencies[c->count++] = platform_get_time_ns() - start;
+    if (out->seq != r->seq) {
+        log_error_and_abort("Response out of order (%u != %u)",
+                            out->seq, r->seq);
+    } else if (out->status != SMD_STATUS_OK) {
+        c->errors++;
+    }
+    return true;
+}
+
+static void* load_client_run(void* data) {
+    load_client_t* c = data;
+    struct sockaddr_un addr = { .sun_family = AF_UNIX };
+    strncpy(addr.sun_path, c->socket_path, sizeof(addr.sun_path) - 1);
+
+    const int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd == -1 || connect(fd, (struct sockaddr*)&addr, sizeof(addr))) {
+        log_error_and_abort("Could not connect to %s (errno: %i)",
+                            c->socket_path, errno);
+    }
+
+    while (c->count + 2 <= c->requests) {
+        smd_request_t r = {
+            .profile = load_rand(&c->seed) % c->profiles,
+            .op = SMD_OP_NEXT,
+        };
+        smd_response_t out;
+        if (!load_call(c, fd, &r, &out)) {
+            log_error_and_abort("Connection closed by daemon");
+        }
+
+        /*  Most answers are right, like a learner who's making progress */
+        if (out.status == SMD_STATUS_OK && out.state) {
+            r.op = SMD_OP_GRADE;
+            r.mode = out.mode;
+            r.state = out.state;
+            r.q = (load_rand(&c->seed) % 4) ? 5 : 1;
+            if (!load_call(c, fd, &r, &out)) {
+                log_error_and_abort("Connection closed by daemon");
+            }
+        }
+    }
+    close(fd);
+    return NULL;
+}
+
+static int load_cmp(const void* a, const void* b) {
+    const int64_t x = *(const int64_t*)a;
+    const int64_t y = *(const int64_t*)b;
+    return (x > y) - (x < y);
+}
+
+int main(int argc, char** argv) {
+    const char* socket_path = SMD_DEFAULT_SOCKET;
+    unsigned clients = 8;
+    unsigned requests = 10000;
+    uint32_t profiles = 100;
+    for (int i=1; i < argc; ++i) {
+        if (!strcmp(argv[i], "--socket") && i + 1 < argc) {
+            socket_path = argv[++i];
+        } else if (!strcmp(argv[i], "--clients") && i + 1 < argc) {
+            clients = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--requests") && i + 1 < argc) {
+            requests = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--profiles") && i + 1 < argc) {
+            profiles = atoi(argv[++i]);
+        } else {
+            log_error_and_abort("Unknown argument '%s'", argv[i]);
+        }
+    }
+    if (!clients || requests < 2 || !profiles) {
+        log_error_and_abort("--clients and --profiles must be at least 1, "
+                            "and --requests at least 2");
+    }
+
+    load_client_t* cs = calloc(clients, sizeof(load_client_t));
+    platform_thread_t** threads = calloc(clients, sizeof(*threads));
+    const int64_t start = platform_get_time_ns();
+    for (unsigned i=0; i < clients; ++i) {
+        cs[i] = (load_client_t){
+            .socket_path = socket_path,
+            .profiles = profiles,
+            .requests = requests,
+            .seed = 2463534242u + i * 7919u,
+            .latencies = malloc(requests * sizeof(int64_t)),
+        };
+        threads[i] = platform_thread_new(load_client_run, &cs[i]);
+    }
+
+    size_t total = 0;
+    unsigned errors = 0;
+    for (unsigned i=0; i < clients; ++i) {
+        platform_thread_join(threads[i]);
+        platform_thread_delete(threads[i]);
+        total += cs[i].count;
+        errors += cs[i].errors;
+    }
+    const int64_t elapsed = platform_get_time_ns() - start;
+
+    int64_t* all = malloc(total * sizeof(int64_t));
+    size_t n = 0;
+    for (unsigned i=0; i < clients; ++i) {
+        memcpy(all + n, cs[i].latencies, cs[i].count * sizeof(int64_t));
+        n += cs[i].count;
+        free(cs[i].latencies);
+    }
+    qsort(all, total, sizeof(int64_t), load_cmp);
+
+    printf("clients %u\n", clients);
+    printf("requests %zu\n", total);
+    printf("errors %u\n", errors);
+    printf("requests_per_s %.0f\n", total / (elapsed / 1e9));
+    printf("latency_p50_us %.1f\n", all[total / 2] / 1e3);
+    printf("latency_p99_us %.1f\n", all[total * 99 / 100] / 1e3);
+    printf("latency_p999_us %.1f\n", all[total * 999 / 1000] / 1e3);
+    printf("latency_max_us %.1f\n", all[total - 1] / 1e3);
+
+    free(all);
+    free(threads);
+    free(cs);
+    return 0;
+}
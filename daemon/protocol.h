@@ -0,0 +1,38 @@
+#include <stdint.h>
+
+/*  Wire format for the quiz daemon (see smd.c).  Clients send fixed-size
+ *  requests and receive one fixed-size response per request, in order.
+ *  Since the socket is local, fields are in host byte order. */
+
+#define SMD_DEFAULT_SOCKET "/tmp/states-machine.sock"
+
+enum {
+    SMD_OP_NEXT = 1,    /* Returns the next item to test */
+    SMD_OP_GRADE = 2,   /* Grades an item with a quality score (0-5) */
+};
+
+enum {
+    SMD_STATUS_OK = 0,
+    SMD_STATUS_ERROR = 1,
+};
+
+typedef struct {
+    uint32_t seq;       /* Echoed back in the response */
+    uint32_t profile;   /* Learner profile ID */
+    uint8_t op;
+    uint8_t mode;       /* Item mode (see sm2.h), for grades */
+    uint8_t state;      /* 1-indexed state ID, for grades */
+    uint8_t q;          /* Quality score, for grades */
+} smd_request_t;
+
+typedef struct {
+    uint32_t seq;
+    uint8_t status;
+    uint8_t mode;       /* For SMD_OP_NEXT, the item to test */
+    uint8_t state;
+    uint8_t reserved;
+} smd_response_t;
+
+/*  The structs are sent as-is, so make sure there's no padding */
+typedef char smd_request_size_check[sizeof(smd_request_t) == 12 ? 1 : -1];
+typedef char smd_response_size_check[sizeof(smd_response_t) == 8 ? 1 : -1];
@@ -0,0 +1,313 @@
+/*  Quiz daemon, which hosts the SM2 scheduler for many learner profiles
+ *  and serves requests from kiosks over a local UNIX socket.
+ *
+ *  Every profile is stored in one database, which is opened once (so
+ *  memory use doesn't grow with the number of profiles).  Requests are
+ *  handled in batches:  every request that arrives in one pass through
+ *  poll() is processed in a single transaction, which is committed
+ *  before any responses are sent.  Under load, this amortizes disk syncs
+ *  across many users. */
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "log.h"
+#include "object.h"
+#include "platform.h"
+#include "protocol.h"
+#include "sm2.h"
+#include "timing.h"
+
+/*  Maximum number of requests buffered per connection.  A connection
+ *  isn't read again until all of its responses have been sent, which
+ *  bounds memory use for clients that don't read their responses. */
+#define SMD_CONN_REQUESTS 1024
+
+typedef struct {
+    int fd;
+
+    uint8_t in[SMD_CONN_REQUESTS * sizeof(smd_request_t)];
+    size_t in_size;
+
+    uint8_t out[SMD_CONN_REQUESTS * sizeof(smd_response_t)];
+    size_t out_size;
+    size_t out_sent;
+} smd_conn_t;
+
+typedef struct {
+    sm2_t* sm2;
+    int listener;
+
+    /*  Set if a transaction is open in the current batch */
+    bool in_batch;
+
+    smd_conn_t** conns;
+    size_t conn_count;
+    size_t conn_capacity;
+    struct pollfd* fds;
+} smd_t;
+
+static volatile sig_atomic_t smd_stop = 0;
+
+static void smd_on_signal(int sig) {
+    (void)sig;
+    smd_stop = 1;
+}
+
+static bool smd_nonblocking(int fd) {
+    const int flags = fcntl(fd, F_GETFL, 0);
+    return flags != -1 && fcntl(fd, F_SETFL, flags | O_NONBLOCK) != -1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+/*  Returns the scheduler with the given profile active, starting a
+ *  transaction if one isn't already open in this batch */
+static sm2_t* smd_profile(smd_t* smd, uint32_t id) {
+    if (!smd->in_batch) {
+        sm2_begin(smd->sm2);
+        smd->in_batch = true;
+    }
+    sm2_set_profile(smd->sm2, id);
+    return smd->sm2;
+}
+
+static void smd_commit(smd_t* smd) {
+    if (smd->in_batch) {
+        sm2_commit(smd->sm2);
+        smd->in_batch = false;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+static smd_response_t smd_handle(smd_t* smd, const smd_request_t* r) {
+    smd_response_t out = { .seq = r->seq, .status = SMD_STATUS_ERROR };
+    if (r->op == SMD_OP_NEXT) {
+        sm2_item_t* item = sm2_next(smd_profile(smd, r->profile));
+        out.status = SMD_STATUS_OK;
+        out.mode = item->mode;
+        out.state = item->state;
+        sm2_item_delete(item);
+    } else if (r->op == SMD_OP_GRADE && r->q <= 5) {
+        sm2_t* sm2 = smd_profile(smd, r->profile);
+        sm2_item_t* item = sm2_find(sm2, r->state, r->mode);
+        if (item) {
+            sm2_update(sm2, item, r->q);
+            sm2_item_delete(item);
+            out.status = SMD_STATUS_OK;
+            out.mode = r->mode;
+            out.state = r->state;
+        }
+    }
+    return out;
+}
+
+/*  Handles every complete request that the connection has buffered */
+static void smd_conn_handle(smd_t* smd, smd_conn_t* c) {
+    size_t i;
+    for (i=0; i + sizeof(smd_request_t) <= c->in_size;
+         i += sizeof(smd_request_t))
+    {
+        smd_request_t r;
+        memcpy(&r, c->in + i, sizeof(r));
+        const smd_response_t out = smd_handle(smd, &r);
+        memcpy(c->out + c->out_size, &out, sizeof(out));
+        c->out_size += sizeof(out);
+    }
+    /*  Keep any partial request for next time */
+    memmove(c->in, c->in + i, c->in_size - i);
+    c->in_size -= i;
+}
+
+/*  Reads as much as possible, returning false if the connection closed */
+static bool smd_conn_read(smd_conn_t* c) {
+    while (c->in_size < sizeof(c->in)) {
+        const ssize_t n = read(c->fd, c->in + c->in_size,
+                               sizeof(c->in) - c->in_size);
+        if (n > 0) {
+            c->in_size += n;
+        } else if (n == 0) {
+            return false;
+        } else if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            return true;
+        } else if (errno != EINTR) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*  Sends as much as possible, returning false if the connection closed */
+static bool smd_conn_write(smd_conn_t* c) {
+    while (c->out_sent < c->out_size) {
+        const ssize_t n = write(c->fd, c->out + c->out_sent,
+                                c->out_size - c->out_sent);
+        if (n >= 0) {
+            c->out_sent += n;
+        } else if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            return true;
+        } else if (errno != EINTR) {
+            return false;
+        }
+    }
+    c->out_size = 0;
+    c->out_sent = 0;
+    return true;
+}
+
+static void smd_accept(smd_t* smd) {
+    while (1) {
+        const int fd = accept(smd->listener, NULL, NULL);
+        if (fd == -1) {
+            if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+                log_error("accept failed (errno: %i)", errno);
+            }
+            return;
+        } else if (!smd_nonblocking(fd)) {
+            log_error("Could not make connection non-blocking");
+            close(fd);
+            continue;
+        }
+
+        if (smd->conn_count == smd->conn_capacity) {
+            smd->conn_capacity *= 2;
+            smd->conns = realloc(smd->conns,
+                                 smd->conn_capacity * sizeof(*smd->conns));
+            smd->fds = realloc(smd->fds,
+                               (smd->conn_capacity + 1) * sizeof(*smd->fds));
+        }
+        smd_conn_t* c = calloc(1, sizeof(smd_conn_t));
+        c->fd = fd;
+        smd->conns[smd->conn_count++] = c;
+        log_trace("Accepted connection %i", fd);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+static void smd_run(smd_t* smd) {
+    while (!smd_stop) {
+        /*  Connections with unsent responses only wait to write,
+         *  which applies backpressure to clients that don't read. */
+        smd->fds[0] = (struct pollfd){ .fd = smd->listener, .events = POLLIN };
+        for (size_t i=0; i < smd->conn_count; ++i) {
+            smd->fds[i + 1] = (struct pollfd){
+                .fd = smd->conns[i]->fd,
+                .events = smd->conns[i]->out_size ? POLLOUT : POLLIN };
+        }
+        const size_t conn_count = smd->conn_count;
+        if (poll(smd->fds, conn_count + 1, -1) == -1) {
+            if (errno != EINTR) {
+                log_error_and_abort("poll failed (errno: %i)", errno);
+            }
+            continue;
+        }
+
+        /*  Read and handle every request that's available */
+        TIMING_BEGIN(smd_batch);
+        bool* closed = calloc(conn_count, sizeof(bool));
+        for (size_t i=0; i < conn_count; ++i) {
+            smd_conn_t* c = smd->conns[i];
+            const short ev = smd->fds[i + 1].revents;
+            if ((ev & (POLLIN | POLLHUP | POLLERR)) && !c->out_size) {
+                closed[i] = !smd_conn_read(c);
+                smd_conn_handle(smd, c);
+            }
+        }
+        smd_commit(smd);
+        TIMING_END(smd_batch);
+
+        /*  Responses are only sent once their updates are committed */
+        for (size_t i=0; i < conn_count; ++i) {
+            smd_conn_t* c = smd->conns[i];
+            if (!closed[i] && c->out_size) {
+                closed[i] = !smd_conn_write(c);
+            }
+        }
+
+        /*  Remove closed connections, keeping the rest in order */
+        size_t j = 0;
+        for (size_t i=0; i < conn_count; ++i) {
+            if (closed[i]) {
+                log_trace("Closed connection %i", smd->conns[i]->fd);
+                close(smd->conns[i]->fd);
+                free(smd->conns[i]);
+            } else {
+                smd->conns[j++] = smd->conns[i];
+            }
+        }
+        smd->conn_count = j;
+        free(closed);
+
+        if (smd->fds[0].revents & POLLIN) {
+            smd_accept(smd);
+        }
+        timing_report(10000000000LL);
+    }
+}
+
+int main(int argc, char** argv) {
+    const char* socket_path = SMD_DEFAULT_SOCKET;
+    const char* db = "smd.sqlite";
+    for (int i=1; i < argc; ++i) {
+        if (!strcmp(argv[i], "--socket") && i + 1 < argc) {
+            socket_path = argv[++i];
+        } else if (!strcmp(argv[i], "--db") && i + 1 < argc) {
+            db = argv[++i];
+        } else {
+            log_error_and_abort("Unknown argument '%s'", argv[i]);
+        }
+    }
+    struct sockaddr_un addr = { .sun_family = AF_UNIX };
+    if (strlen(socket_path) >= sizeof(addr.sun_path)) {
+        log_error_and_abort("Socket path is too long: %s", socket_path);
+    }
+    strcpy(addr.sun_path, socket_path);
+
+    OBJECT_ALLOC(smd);
+    smd->sm2 = sm2_new(db);
+    smd->listener = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (smd->listener == -1) {
+        log_error_and_abort("socket failed (errno: %i)", errno);
+    }
+    unlink(socket_path);
+    if (bind(smd->listener, (struct sockaddr*)&addr, sizeof(addr)) ||
+        listen(smd->listener, SOMAXCONN) ||
+        !smd_nonblocking(smd->listener))
+    {
+        log_error_and_abort("Could not listen on %s (errno: %i)",
+                            socket_path, errno);
+    }
+
+    smd->conn_capacity = 16;
+    smd->conns = malloc(smd->conn_capacity * sizeof(*smd->conns));
+    smd->fds = malloc((smd->conn_capacity + 1) * sizeof(*smd->fds));
+
+    /*  Stop cleanly on Ctrl-C, and don't die if a client disconnects
+     *  while we're writing to it */
+    struct sigaction sa = { .sa_handler = smd_on_signal };
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+    signal(SIGPIPE, SIG_IGN);
+
+    log_info("Listening on %s, with profiles in %s", socket_path, db);
+    smd_run(smd);
+    log_info("Shutting down");
+
+    for (size_t i=0; i < smd->conn_count; ++i) {
+        close(smd->conns[i]->fd);
+        free(smd->conns[i]);
+    }
+    sm2_delete(smd->sm2);
+    close(smd->listener);
+    unlink(socket_path);
+    free(smd->conns);
+    free(smd->fds);
+    free(smd);
+    return 0;
+}
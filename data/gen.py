@@ -122,6 +122,48 @@ def translate(state, scale, offset):
 translate('Alaska', 0.4, [20, -20])
 translate('Hawaii', 1.0, [25, 15])
 
+# Find the outline of each state, which is every edge that belongs to only
+# one triangle.  These are drawn as lines, so borders stay sharp at any
+# resolution.
+edge_count = {}
+for t in packed_indexes:
+    for (a,b) in ((t[0], t[1]), (t[1], t[2]), (t[2], t[0])):
+        e = (min(a,b), max(a,b))
+        edge_count[e] = edge_count.get(e, 0) + 1
+packed_edges = np.array([e for (e,n) in edge_count.items() if n == 1])
+
+# Build a perfect hash from state name to (1-based) ID, using hash and
+# displace: names are split into buckets with a fixed seed, then each
+# bucket (largest first) searches for a seed that puts all of its names
+# into empty slots.  This must match states_hash in src/states.c
+def fnv1a(seed, s):
+    h = (2166136261 ^ seed) & 0xFFFFFFFF
+    for c in s.encode('utf-8'):
+        h = ((h ^ c) * 16777619) & 0xFFFFFFFF
+    return h
+
+names = list(indexed.keys())
+hash_buckets = max(1, len(names) // 4)
+hash_size = 1
+while hash_size < len(names) * 5 // 4:
+    hash_size *= 2
+buckets = [[] for i in range(hash_buckets)]
+for (i,s) in enumerate(names):
+    buckets[fnv1a(0, s) % hash_buckets].append(i + 1)
+hash_seeds = [0] * hash_buckets
+hash_slots = [0] * hash_size
+for b in sorted(range(hash_buckets), key=lambda b: -len(buckets[b])):
+    seed = 1
+    while True:
+        slots = [fnv1a(seed, names[i - 1]) % hash_size for i in buckets[b]]
+        if (len(set(slots)) == len(slots) and
+                all(not hash_slots[j] for j in slots)):
+            break
+        seed += 1
+    hash_seeds[b] = seed
+    for (i,j) in zip(buckets[b], slots):
+        hash_slots[j] = i
+
 # Print a C file to stdout
 print("// This file was generated by gen.py; do not edit by hand!\n")
 print("#include <stdint.h>\n")
@@ -131,6 +173,16 @@ for (i,s) in enumerate(indexed):
     print('    "' + s + '",');
 print("};\n");
 
+print("const unsigned STATES_HASH_BUCKETS = %u;" % hash_buckets)
+print("const uint16_t STATES_HASH_SEEDS[%u] = {" % hash_buckets)
+for i in range(0, hash_buckets, 16):
+    print("    " + ", ".join(map(str, hash_seeds[i:i+16])) + ",")
+print("};\n")
+print("const unsigned STATES_HASH_SIZE = %u;" % hash_size)
+print("const uint16_t STATES_HASH_SLOTS[%u] = {" % hash_size)
+for i in range(0, hash_size, 16):
+    print("    " + ", ".join(map(str, hash_slots[i:i+16])) + ",")
+print("};\n")
 print("const unsigned STATES_VERT_COUNT = %u;" % (packed_verts.shape[0]))
 print("const float STATES_VERTS[%u] = {" % packed_verts.size)
 for row in packed_verts:
@@ -140,6 +192,11 @@ print("const unsigned STATES_TRI_COUNT = %u;" % (packed_indexes.shape[0]))
 print("const uint16_t STATES_INDEXES[%u] = {" % packed_indexes.size)
 for row in packed_indexes:
     print("    " + ",".join(map(str, row)) + ",")
+print("};\n")
+print("const unsigned STATES_EDGE_COUNT = %u;" % (packed_edges.shape[0]))
+print("const uint16_t STATES_EDGES[%u] = {" % packed_edges.size)
+for row in packed_edges:
+    print("    " + ",".join(map(str, row)) + ",")
 print("};")
 
 font = open('Inconsolata.ttf', 'rb').read()
@@ -6,7 +6,7 @@ APP="States Machine.app"
 
 cd ../..
 make clean
-make -j8
+env LOG_LEVEL=LOG_INFO make -j8
 strip states-machine
 
 # Parse the revision, branch, and tag from version.c
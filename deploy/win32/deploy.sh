@@ -3,7 +3,7 @@ set -x -e
 
 cd ../..
 TARGET=win32-cross make clean
-TARGET=win32-cross make -j8
+TARGET=win32-cross LOG_LEVEL=LOG_INFO make -j8
 x86_64-w64-mingw32-strip StatesMachine.exe
 
 # Parse the revision, branch, and tag from version.c
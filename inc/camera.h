@@ -3,10 +3,13 @@
 /*  Forward declaration of camera struct */
 typedef struct camera_ camera_t;
 
+/*  Uniform location for the combined model-view-projection matrix,
+ *  plus a record of what was last uploaded (to skip redundant uploads) */
 typedef struct camera_uniforms_ {
-    GLint proj;
-    GLint view;
-    GLint model;
+    GLint mvp;
+
+    const camera_t* bound;
+    uint32_t generation;
 } camera_uniforms_t;
 
 /*  Constructs a new heap-allocated camera */
@@ -38,8 +41,15 @@ void camera_set_mouse_pos(camera_t* camera, float x, float y);
 void camera_anim_proj_perspective(camera_t* camera);
 void camera_anim_proj_orthographic(camera_t* camera);
 
-/*  Checks whether there is an animation running on the camera.
- *  If so, the values are updated.  If the animation is incomplete,
+/*  Animates the camera to frame a region, given in model coordinates
+ *  (like camera_set_model).  scale is the region's half-size. */
+void camera_fly_to(camera_t* camera, const float* center, float scale);
+
+/*  Animates the camera back to show the whole model */
+void camera_fly_home(camera_t* camera);
+
+/*  Checks whether there are animations running on the camera.
+ *  If so, the values are updated.  If any animation is incomplete,
  *  returns true (so the caller should schedule a redraw). */
 bool camera_check_anim(camera_t* camera);
 
@@ -49,12 +59,19 @@ float camera_aspect_ratio(camera_t* camera);
 /*  Looks up uniforms for camera binding */
 camera_uniforms_t camera_get_uniforms(GLuint prog);
 
-/*  Binds the camera matrices to the given uniforms */
-void camera_bind(camera_t* camera, camera_uniforms_t u);
+/*  Binds the camera's model-view-projection matrix to the given uniform.
+ *  The upload is skipped if the camera hasn't changed since the last call
+ *  with the same uniforms struct, so there must be one struct per program
+ *  (even if the program is used from several contexts). */
+void camera_bind(camera_t* camera, camera_uniforms_t* u);
 
 /*  Translates from window to framebuffer pixel locations */
 void camera_get_fb_pixel(camera_t* camera, int x, int y, int* fx, int* fy);
 
+/*  Returns a counter which changes whenever the camera's matrices do,
+ *  so that anything drawn with the camera can tell if it's stale */
+uint32_t camera_generation(camera_t* camera);
+
 /*  If the OpenGL viewport doesn't match the camera,
  *  calls glViewport with the camera's width and height */
 void camera_check_viewport(camera_t* camera);
@@ -6,5 +6,13 @@ extern const unsigned STATES_VERT_COUNT;
 extern const unsigned STATES_TRI_COUNT;
 extern const float STATES_VERTS[];
 extern const uint16_t STATES_INDEXES[];
+extern const unsigned STATES_EDGE_COUNT;
+extern const uint16_t STATES_EDGES[];
 extern const char* STATES_NAMES[];
 extern const uint8_t FONT[];
+
+// Perfect hash from name to state, used by states_lookup
+extern const unsigned STATES_HASH_BUCKETS;
+extern const uint16_t STATES_HASH_SEEDS[];
+extern const unsigned STATES_HASH_SIZE;
+extern const uint16_t STATES_HASH_SLOTS[];
@@ -1,13 +1,37 @@
 #include "base.h"
 
 typedef struct gui_ gui_t;
+typedef struct gui_font_ gui_font_t;
 
-gui_t* gui_new(void);
+/*  Builds the font atlas on the CPU.  This doesn't touch OpenGL,
+ *  so it can run on a worker thread before calling gui_new. */
+gui_font_t* gui_font_new(void);
+
+/*  Constructs the GUI, uploading and taking ownership of the font.
+ *
+ *  If share is not NULL, the font should be NULL:  the new GUI uses the
+ *  font texture and program from share (which requires the current
+ *  context to share objects with the one that built it), and share must
+ *  outlive it. */
+gui_t* gui_new(gui_font_t* font, const gui_t* share);
 void gui_delete(gui_t* gui);
 
 void gui_reset(gui_t* gui);
 void gui_backdrop(gui_t* gui, float aspect_ratio);
+
+/*  Draws a white panel with a drop shadow, spanning most of the window's
+ *  width and the given range of heights (in normalized coordinates) */
+void gui_panel(gui_t* gui, float aspect_ratio, float y0, float y1);
+/*  Prints a string, centered at the given height.  Control characters
+ *  change the style: 1 is grey, 2 is black, 3 starts an underlined text
+ *  field which is padded to pad_to characters and ended by 4 (with a
+ *  cursor), 5 draws a squircle behind the next character, 6 is light
+ *  grey, and 7 starts ghost text in a text field (placing the cursor
+ *  before it). */
 void gui_print(gui_t* gui, const char* s,
                float aspect_ratio, float y_pos,
                int pad_to);
+
+/*  Draws everything added since gui_reset, in call order (so later calls
+ *  are drawn on top of earlier ones) */
 void gui_draw(gui_t* gui);
@@ -2,12 +2,46 @@
 
 struct theme_;
 
+/*  Options for constructing an instance */
+typedef struct instance_config_ {
+    /*  Path to the spaced-repetition database (see sm2_new) */
+    const char* db_path;
+
+    /*  Learner profile within that database (0 by default) */
+    uint32_t profile;
+
+    /*  Size of the picking buffer relative to the framebuffer, or 0 to
+     *  use the default (see pick.h) */
+    float pick_scale;
+
+    /*  If true, the window is never shown */
+    bool headless;
+
+    /*  If not NULL, input events are recorded to this file */
+    const char* record_path;
+
+    /*  If not NULL, items are read from this recording (instead of being
+     *  picked by sm2), so that a replayed session sees the same items */
+    struct record_* replay;
+
+    /*  If not NULL, the new instance's window shares OpenGL objects (map
+     *  geometry, font texture, and programs) with this instance, which
+     *  also lends its job system and database (so db_path is ignored).
+     *  It must outlive the new instance. */
+    struct instance_* share;
+} instance_config_t;
+
 typedef struct instance_ {
     struct camera_* camera;
-    struct compositor_* compositor;
     struct gui_* gui;
+    struct jobs_* jobs;
     struct map_* map;
+    struct match_* match;
+    struct pick_* pick;
+    struct profiler_* profiler;
+    struct record_* record;
     struct sm2_* sm2;
+    struct trie_* trie;
 
     /*  Mouse position is in framebuffer pixels */
     int mouse_x;
@@ -19,7 +53,8 @@ typedef struct instance_ {
 
     struct sm2_item_* active;
 
-    /*  Text buffer to type in the state name */
+    /*  Text buffer to type in the state name, which is tracked by the
+     *  trie's cursor for autocompletion */
     char input[32];
     unsigned input_index;
     unsigned input_size;
@@ -31,10 +66,37 @@ typedef struct instance_ {
      *  Otherwise, this is zero. */
     int wrong_state;
 
+    /*  Motion and scroll events are coalesced here, then applied once
+     *  per frame by instance_flush_input */
+    struct {
+        bool has_pos;
+        float x;
+        float y;
+        float scroll_x;
+        float scroll_y;
+    } pending;
+
+    /*  Toggled with F3 to show frame timing */
+    bool show_profiler;
+
+    /*  Time at which instance_new was called (in nanoseconds), used to log
+     *  the time to the first frame (then cleared to zero) */
+    int64_t start_time;
+
+    /*  Borrowed from the config, not owned by the instance */
+    struct record_* replay;
+
+    /*  Learner profile, which is selected in sm2 before every use (since
+     *  the database may be shared with other instances) */
+    uint32_t profile;
+
+    /*  If set, jobs and sm2 are borrowed from another instance */
+    bool shared;
+
     GLFWwindow* window;
 } instance_t;
 
-instance_t* instance_new(void);
+instance_t* instance_new(const instance_config_t* config);
 void instance_delete(instance_t* instance);
 
 void instance_update_active_state(instance_t* instance);
@@ -51,6 +113,14 @@ void instance_view_wireframe(instance_t* instance);
 void instance_view_orthographic(instance_t* instance);
 void instance_view_perspective(instance_t* instance);
 
+/*  Records motion and scroll events, to be applied (once per frame)
+ *  by instance_flush_input.  Other events apply immediately, but flush
+ *  any queued input first so that they see the latest mouse position. */
+void instance_queue_mouse_pos(instance_t* instance, float xpos, float ypos);
+void instance_queue_mouse_scroll(instance_t* instance,
+                                 float xoffset, float yoffset);
+void instance_flush_input(instance_t* instance);
+
 /*  Callbacks */
 void instance_cb_window_size(instance_t* instance, int width, int height);
 void instance_cb_framebuffer_size(instance_t* instance, int width, int height);
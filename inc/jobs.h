@@ -0,0 +1,43 @@
+#include "base.h"
+
+/*  A small work-stealing job system.  Each worker thread has its own
+ *  deque: it pushes and pops jobs at the back, while idle workers steal
+ *  from the front.  Jobs submitted from other threads (e.g. the main
+ *  thread) go into a shared deque that everyone steals from. */
+typedef struct jobs_ jobs_t;
+
+/*  Counts outstanding jobs.  This is incremented when a job is submitted
+ *  and decremented when it finishes, so it reaches zero once every job
+ *  using it is done.  Counters must be zero-initialized, and must outlive
+ *  the jobs that use them. */
+typedef struct {
+    int count;
+} jobs_counter_t;
+
+typedef void (*jobs_fn_t)(void* data);
+
+/*  Spawns the given number of worker threads.  If workers is 0, then uses
+ *  one fewer than the number of CPUs (at least one, and at most four). */
+jobs_t* jobs_new(unsigned workers);
+
+/*  Finishes all queued jobs, then stops the worker threads */
+void jobs_delete(jobs_t* jobs);
+
+/*  Queues a job.  If counter is not NULL, it's incremented now and
+ *  decremented once the job finishes. */
+void jobs_run(jobs_t* jobs, jobs_fn_t fn, void* data,
+              jobs_counter_t* counter);
+
+/*  Queues a job that won't start until the after counter reaches zero,
+ *  which is how dependencies between jobs are expressed. */
+void jobs_run_after(jobs_t* jobs, jobs_counter_t* after,
+                    jobs_fn_t fn, void* data, jobs_counter_t* counter);
+
+/*  Runs other jobs on the calling thread until the counter reaches zero */
+void jobs_wait(jobs_t* jobs, jobs_counter_t* counter);
+
+/*  Calls fn on [begin, end) chunks of [0, n), with up to grain items per
+ *  chunk, in parallel.  Returns once every chunk is done. */
+typedef void (*jobs_range_fn_t)(void* data, size_t begin, size_t end);
+void jobs_parallel_for(jobs_t* jobs, size_t n, size_t grain,
+                       jobs_range_fn_t fn, void* data);
@@ -7,16 +7,48 @@ typedef enum {
     LOG_ERROR,
 } log_type_t;
 
-void log_lock();
-void log_unlock();
-FILE* log_preamble(log_type_t t, const char* file, int line);
-
-#define log_print(t, ...) do {                          \
-    log_lock();                                         \
-    FILE* out = log_preamble(t, __FILE__, __LINE__);    \
-    fprintf(out, __VA_ARGS__);                          \
-    fprintf(out, "\n");                                 \
-    log_unlock();                                       \
+/*  Messages below this level are compiled out (though their arguments
+ *  are still type-checked).  Set with LOG_LEVEL in the Makefile. */
+#ifndef LOG_MIN_LEVEL
+#define LOG_MIN_LEVEL LOG_TRACE
+#endif
+
+/*  Each call site has a static log_site_t, which caches its filename,
+ *  padding, and ID (for the binary log) after the first call. */
+typedef struct log_site_ {
+    log_type_t type;
+    const char* file;
+    int line;
+
+    uint32_t id;
+    const char* filename;
+    const char* fmt;
+    int pad;
+    struct log_site_* next;
+} log_site_t;
+
+/*  Formats a message and queues it for the background logging thread.
+ *  Errors (and messages too long to queue) are instead written before
+ *  returning, after any messages that were already queued.
+ *
+ *  If the binary log is open, messages are written there instead (with
+ *  raw arguments rather than formatted text), and only errors are also
+ *  printed to the terminal. */
+void log_message(log_site_t* site, const char* fmt, ...)
+    __attribute__((format(printf, 2, 3)));
+
+/*  Blocks until every queued message has been written */
+void log_flush(void);
+
+/*  Redirects log messages to a binary file, which can be decoded with
+ *  tools/log_decode.py.  Returns false if the file can't be opened. */
+bool log_binary_open(const char* filename);
+
+#define log_print(t, ...) do {                                  \
+    if ((t) >= LOG_MIN_LEVEL) {                                 \
+        static log_site_t log_site_ = {(t), __FILE__, __LINE__};\
+        log_message(&log_site_, __VA_ARGS__);                   \
+    }                                                           \
 } while (0)
 
 #define log_trace(...)  log_print(LOG_TRACE, __VA_ARGS__)
@@ -5,9 +5,34 @@ struct camera_;
 
 typedef struct map_ map_t;
 
+/*  Center and size of the map data, in the coordinates of data.c */
+typedef struct map_bounds_ {
+    float center[3];
+    float scale;
+} map_bounds_t;
+
+/*  Scans the map data for its bounds.  This doesn't touch OpenGL,
+ *  so it can run on a worker thread before calling map_new. */
+map_bounds_t map_bounds(void);
+
+/*  Scans the map data for the bounds of a single state, which is
+ *  1-indexed (like the active state in instance_t) */
+map_bounds_t map_state_bounds(unsigned state);
+
 /*  Constructs a new map from data in data.c, updating the
- *  camera's model matrix to center the map at 0. */
-map_t* map_new(struct camera_* camera);
+ *  camera's model matrix to center the map at 0.
+ *
+ *  If share is not NULL, then the new map uses its programs and buffers
+ *  (which requires the current context to share objects with the one
+ *  that built share), and share must outlive it. */
+map_t* map_new(struct camera_* camera, map_bounds_t bounds,
+               const map_t* share);
 void map_delete(map_t* map);
 
-void map_draw(map_t* map, struct camera_* camera);
+/*  Draws the map in color, with state borders, into the current
+ *  framebuffer.  States are 1-indexed, and 0 highlights nothing. */
+void map_draw(map_t* map, struct camera_* camera,
+              int active_state, int wrong_state);
+
+/*  Draws each state's ID into an integer framebuffer, for picking */
+void map_draw_ids(map_t* map, struct camera_* camera);
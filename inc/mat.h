@@ -15,10 +15,13 @@ mat4_t mat4_translation(const vec3_t d);
 /*  Constructs a uniform scaling matrix */
 mat4_t mat4_scaling(const float s);
 
-/*  Matrix math */
-mat4_t mat4_mul(const mat4_t a, const mat4_t b);
-vec3_t mat4_apply(const mat4_t a, const vec3_t v);
-mat4_t mat4_inv(const mat4_t in);
+/*  Matrix math, using SSE or NEON where available */
+mat4_t mat4_mul(const mat4_t* a, const mat4_t* b);
+vec3_t mat4_apply(const mat4_t* m, const vec3_t v);
+mat4_t mat4_inv(const mat4_t* in);
+
+/*  Applies a matrix to an array of points.  in and out may be the same. */
+void mat4_apply_n(const mat4_t* m, const vec3_t* in, vec3_t* out, size_t n);
 
 /*  Basic vector length */
 float vec3_length(const vec3_t v);
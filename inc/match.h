@@ -0,0 +1,25 @@
+#include "base.h"
+
+/*  Typo-tolerant name matching.  Names are stored in a BK-tree keyed by
+ *  edit distance, which is computed with Myers' bit-parallel algorithm.
+ *  Matching ignores ASCII case. */
+typedef struct match_ match_t;
+
+/*  Builds a matcher over an array of names, which must outlive it */
+match_t* match_new(const char** names, unsigned count);
+void match_delete(match_t* match);
+
+/*  Returns the Levenshtein distance between two strings */
+unsigned match_distance(const char* a, const char* b);
+
+/*  Returns the number of typos accepted when matching the given name
+ *  (one per four characters, but at least one) */
+unsigned match_tolerance(const char* name);
+
+/*  Finds the name closest to the input, within max_dist edits.  Returns
+ *  its 1-indexed position in the names array, or 0 if there is no name
+ *  that close.  If dist is not NULL, the distance is stored there.
+ *
+ *  This uses scratch space in the matcher, so it is not thread-safe. */
+unsigned match_find(match_t* match, const char* input,
+                    unsigned max_dist, unsigned* dist);
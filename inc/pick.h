@@ -0,0 +1,29 @@
+#include "base.h"
+
+/*  Picking target, which stores the state ID under each pixel in an
+ *  integer texture.  Picking doesn't need full precision, so the texture
+ *  is scaled relative to the framebuffer, and it's only redrawn when a
+ *  pick happens after the camera has changed. */
+typedef struct pick_ pick_t;
+
+/*  At this scale, the texture matches window coordinates on a 2x
+ *  high-DPI display, which is as precise as the mouse */
+#define PICK_DEFAULT_SCALE 0.5f
+
+/*  The width and height are framebuffer sizes, in pixels */
+pick_t* pick_new(float scale, uint32_t width, uint32_t height);
+void pick_delete(pick_t* pick);
+void pick_resize(pick_t* pick, uint32_t width, uint32_t height);
+
+/*  If the texture is out of date (i.e. the camera has changed since it
+ *  was drawn, based on camera_generation), binds it for drawing and
+ *  returns true; the caller should then draw state IDs and call pick_end.
+ *  Otherwise, returns false. */
+bool pick_begin(pick_t* pick, uint32_t generation);
+
+/*  Rebinds the window's framebuffer and viewport */
+void pick_end(pick_t* pick);
+
+/*  Returns the state at the given framebuffer pixel (as returned by
+ *  camera_get_fb_pixel), or 0 if there's no state there */
+int pick_state_at(pick_t* pick, int x, int y);
@@ -6,7 +6,9 @@ const char* platform_mmap_data(platform_mmap_t* m);
 size_t platform_mmap_size(platform_mmap_t* m);
 void platform_munmap(platform_mmap_t* m);
 
-/*  Returns time in microseconds */
+/*  Returns time from a monotonic clock, in nanoseconds or microseconds.
+ *  The starting point is arbitrary, so this is only useful for intervals. */
+int64_t platform_get_time_ns(void);
 int64_t platform_get_time(void);
 
 /*  Based on 8-color ANSI terminals */
@@ -46,6 +48,9 @@ platform_thread_t*  platform_thread_new(void *(*run)(void *),
 void platform_thread_delete(platform_thread_t* thread);
 int platform_thread_join(platform_thread_t* thread);
 
+/*  Returns the number of online CPUs (at least 1) */
+unsigned platform_cpu_count(void);
+
 ////////////////////////////////////////////////////////////////////////////////
 
 /*  Initializes the menu and other native features */
@@ -54,4 +59,7 @@ void platform_window_bind(GLFWwindow* window);
 
 /*  Returns the filename portion of a full path */
 const char* platform_filename(const char* filepath);
-const char* platform_get_user_file(const char* file);
+/*  Returns the path to a file in the user's data directory (creating the
+ *  directory if needed), or NULL on failure.  The caller owns the
+ *  returned string and must free it. */
+char* platform_get_user_file(const char* file);
@@ -0,0 +1,33 @@
+#include "base.h"
+
+// Forward declaration
+struct gui_;
+
+typedef struct profiler_ profiler_t;
+
+/*  Render passes which are timed separately */
+typedef enum {
+    PROFILER_PASS_MAP,
+    PROFILER_PASS_GUI,
+    PROFILER_PASS_COUNT,
+} profiler_pass_t;
+
+profiler_t* profiler_new(void);
+void profiler_delete(profiler_t* profiler);
+
+/*  Marks the beginning and end of a frame.  GPU timer results from
+ *  earlier frames are collected in profiler_frame_begin, without
+ *  blocking if they're not yet available. */
+void profiler_frame_begin(profiler_t* profiler);
+void profiler_frame_end(profiler_t* profiler);
+
+/*  Times a single pass on both the CPU and GPU.  Passes may not nest. */
+void profiler_begin(profiler_t* profiler, profiler_pass_t pass);
+void profiler_end(profiler_t* profiler, profiler_pass_t pass);
+
+/*  Prints recent averages into the GUI, in the bottom of the window */
+void profiler_overlay(profiler_t* profiler, struct gui_* gui,
+                      float aspect_ratio);
+
+/*  Writes the recorded frame history as CSV, returning true on success */
+bool profiler_dump_csv(profiler_t* profiler, const char* filename);
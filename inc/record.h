@@ -0,0 +1,40 @@
+#include "base.h"
+
+/*  Records input events (and the items shown) to a text file, so that
+ *  a session can be replayed later.  Each line is an event, starting
+ *  with its time in microseconds since the recording began. */
+typedef struct record_ record_t;
+
+typedef enum {
+    RECORD_ITEM,        /* i[0] = mode, i[1] = state */
+    RECORD_WINDOW_SIZE, /* i[0] = width, i[1] = height */
+    RECORD_FB_SIZE,     /* i[0] = width, i[1] = height */
+    RECORD_MOUSE_POS,   /* f[0] = x, f[1] = y */
+    RECORD_SCROLL,      /* f[0] = dx, f[1] = dy */
+    RECORD_CLICK,       /* i[0] = button, i[1] = action, i[2] = mods */
+    RECORD_KEY,         /* i[0..3] = key, scancode, action, mods */
+    RECORD_CHAR,        /* i[0] = codepoint */
+    RECORD_FRAME,       /* Marks a call to instance_draw */
+    RECORD_TYPE_COUNT,
+} record_type_t;
+
+typedef struct {
+    record_type_t type;
+    int64_t time_us;
+    int i[4];
+    float f[2];
+} record_event_t;
+
+/*  Opens a recording for writing or reading, returning NULL on failure */
+record_t* record_new(const char* filename, bool write);
+void record_delete(record_t* record);
+
+/*  Appends an event, filling in its timestamp */
+void record_write(record_t* record, record_event_t event);
+
+/*  Reads the next event, returning false at the end of the recording
+ *  (and aborting if the file is malformed) */
+bool record_read(record_t* record, record_event_t* event);
+
+/*  Reads the next event without consuming it */
+bool record_peek(record_t* record, record_event_t* event);
@@ -0,0 +1,6 @@
+#include "base.h"
+
+/*  Replays a recording (see record.h) in a hidden window, as fast as
+ *  possible, against a temporary database.  Frame-time statistics are
+ *  printed to stdout.  Returns false if the recording can't be opened. */
+bool replay_run(const char* filename);
@@ -1,7 +1,8 @@
 #include "base.h"
 
 struct sm2_item_ {
-    const char* state;
+    /*  1-indexed state ID (see states.h), or 0 if mode is DONE */
+    unsigned state;
     enum { ITEM_MODE_NONE,
            ITEM_MODE_POSITION,
            ITEM_MODE_NAME,
@@ -14,12 +15,29 @@ struct sm2_item_ {
 typedef struct sm2_item_ sm2_item_t;
 
 typedef struct sm2_ sm2_t;
-sm2_t* sm2_new(void);
+/*  Opens (or creates) the database at the given path.  This may be
+ *  ":memory:" to use a temporary in-memory database.  Profile 0 is
+ *  active to begin with. */
+sm2_t* sm2_new(const char* path);
 void sm2_delete(sm2_t* sm2);
 
+/*  Switches to a different learner profile, which shares the same
+ *  database (and page cache), adding its items if it's new.  Every
+ *  other function applies to the active profile. */
+void sm2_set_profile(sm2_t* sm2, uint32_t profile);
+
 /*  Returns the next item to test, or an item with mode = DONE */
 sm2_item_t* sm2_next(sm2_t* sm2);
 void sm2_item_delete(sm2_item_t* item);
 
+/*  Looks up a specific item, returning NULL if it doesn't exist.
+ *  The result must be freed with sm2_item_delete. */
+sm2_item_t* sm2_find(sm2_t* sm2, unsigned state, int mode);
+
 /*  Updates the given item with the quality score */
 void sm2_update(sm2_t* sm2, sm2_item_t* item, int q);
+
+/*  Groups every update between these calls into one transaction, so
+ *  that a batch of updates only syncs to disk once.  Calls may not nest. */
+void sm2_begin(sm2_t* sm2);
+void sm2_commit(sm2_t* sm2);
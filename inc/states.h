@@ -0,0 +1,8 @@
+#include "base.h"
+
+/*  Looks up a state by name, using the perfect hash generated in data.c.
+ *  Returns the state's 1-indexed ID, or 0 if the name isn't a state. */
+unsigned states_lookup(const char* name);
+
+/*  Returns the name of a state, given its 1-indexed ID */
+const char* states_name(unsigned state);
@@ -0,0 +1,42 @@
+#include "base.h"
+
+/*  Number of power-of-two histogram buckets, which covers up to ~2^40 ns */
+#define TIMING_BUCKETS 40
+
+/*  Accumulated statistics for a single timed scope.  These are normally
+ *  declared as statics by TIMING_END, and register themselves on first
+ *  use so that timing_report can find them. */
+typedef struct timing_ {
+    const char* name;
+
+    uint64_t count;
+    int64_t total_ns;
+    int64_t max_ns;
+
+    /*  Bucket i counts durations in [2^i, 2^(i + 1)) ns */
+    uint64_t buckets[TIMING_BUCKETS];
+
+    bool registered;
+    struct timing_* next;
+} timing_t;
+
+/*  Adds a duration to the histogram.  This is safe to call from any thread. */
+void timing_record(timing_t* timing, int64_t dt_ns);
+
+/*  Logs a summary of every timing that has been recorded since the last
+ *  report, then resets them.  Does nothing unless at least interval_ns
+ *  has passed since the last report. */
+void timing_report(int64_t interval_ns);
+
+/*  Times a scope, e.g.
+ *      TIMING_BEGIN(frame);
+ *      ...
+ *      TIMING_END(frame);
+ *  The name must be a valid identifier and unique within the function. */
+#define TIMING_BEGIN(name)                                          \
+    const int64_t timing_start_##name = platform_get_time_ns()
+#define TIMING_END(name) do {                                       \
+    static timing_t timing_##name = {#name};                        \
+    timing_record(&timing_##name,                                   \
+                  platform_get_time_ns() - timing_start_##name);    \
+} while (0)
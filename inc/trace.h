@@ -0,0 +1,28 @@
+#include "base.h"
+
+/*  Lightweight tracing, written in the Chrome trace event format (which
+ *  can be opened in chrome://tracing or Perfetto).
+ *
+ *  Tracing is only compiled in when building with TRACE=1; otherwise,
+ *  these macros expand to nothing and their arguments aren't evaluated.
+ *  Names must be string literals (or otherwise outlive the trace). */
+#ifdef TRACE_ENABLED
+
+void trace_begin(const char* name);
+void trace_end(const char* name);
+
+/*  Writes every thread's events to the given file.  This should be called
+ *  once other threads have stopped recording (e.g. at shutdown). */
+bool trace_flush(const char* filename);
+
+#define TRACE_BEGIN(name)       trace_begin(name)
+#define TRACE_END(name)         trace_end(name)
+#define TRACE_FLUSH(filename)   trace_flush(filename)
+
+#else
+
+#define TRACE_BEGIN(name)       do {} while (0)
+#define TRACE_END(name)         do {} while (0)
+#define TRACE_FLUSH(filename)   do {} while (0)
+
+#endif
@@ -0,0 +1,29 @@
+#include "base.h"
+
+/*  A prefix trie over a set of names, used to autocomplete typed input.
+ *  The trie tracks a cursor, which advances by one node per character
+ *  and keeps a stack of visited nodes so that backspace is O(1).
+ *  Matching ignores ASCII case. */
+typedef struct trie_ trie_t;
+
+/*  Builds a trie over an array of names, which must outlive it */
+trie_t* trie_new(const char** names, unsigned count);
+void trie_delete(trie_t* trie);
+
+/*  Moves the cursor back to the empty prefix */
+void trie_reset(trie_t* trie);
+
+/*  Advances the cursor by one character.  If no name continues with
+ *  this character, the cursor moves to a dead end (with no candidates),
+ *  which can still be popped. */
+void trie_push(trie_t* trie, char c);
+
+/*  Moves the cursor back by one character */
+void trie_pop(trie_t* trie);
+
+/*  Returns the number of names that start with the current prefix */
+unsigned trie_count(const trie_t* trie);
+
+/*  Returns the rest of the best (shortest) name with the current prefix,
+ *  or an empty string if there are no candidates */
+const char* trie_completion(const trie_t* trie);
@@ -2,6 +2,10 @@
 
 struct instance_;
 
-GLFWwindow* window_new(const char* filename, float width, float height);
+/*  Creates a hidden window and makes its context current.  If share is
+ *  not NULL, the new context shares objects (buffers, textures, and
+ *  programs, but not VAOs or framebuffers) with that window's context. */
+GLFWwindow* window_new(const char* title, float width, float height,
+                       GLFWwindow* share);
 void window_delete(GLFWwindow* window);
 void window_bind(GLFWwindow* window, struct instance_* instance);
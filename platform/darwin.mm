@@ -86,26 +86,32 @@ extern "C" void platform_init(int argc, char** argv)
     aboutItem.target = GLUE;
 }
 
-extern "C" const char* platform_get_user_file(const char* file)
+extern "C" char* platform_get_user_file(const char* file)
 {
-    NSURL* url = [NSFileManager.defaultManager
-        URLForDirectory:NSApplicationSupportDirectory
-        inDomain:NSUserDomainMask
-        appropriateForURL:nil
-        create:YES
-        error:nil];
-    if (url) {
-        NSString* bundle_id = @"StatesMachine";
-        NSURL* folder = [url URLByAppendingPathComponent:bundle_id];
-        NSURL* path = [folder URLByAppendingPathComponent:
-            [NSString stringWithUTF8String:file]];
-        [NSFileManager.defaultManager
-            createDirectoryAtPath:[folder path]
-            withIntermediateDirectories:YES
-            attributes:nil
+    /*  This may be called from worker threads during startup, which don't
+     *  have an autorelease pool, so we make one here and return a copy of
+     *  the path which outlives it. */
+    @autoreleasepool {
+        NSURL* url = [NSFileManager.defaultManager
+            URLForDirectory:NSApplicationSupportDirectory
+            inDomain:NSUserDomainMask
+            appropriateForURL:nil
+            create:YES
             error:nil];
-        return [[path path] cStringUsingEncoding:NSUTF8StringEncoding];
-    } else {
-        return NULL;
+        if (url) {
+            NSString* bundle_id = @"StatesMachine";
+            NSURL* folder = [url URLByAppendingPathComponent:bundle_id];
+            NSURL* path = [folder URLByAppendingPathComponent:
+                [NSString stringWithUTF8String:file]];
+            [NSFileManager.defaultManager
+                createDirectoryAtPath:[folder path]
+                withIntermediateDirectories:YES
+                attributes:nil
+                error:nil];
+            return strdup([[path path]
+                cStringUsingEncoding:NSUTF8StringEncoding]);
+        } else {
+            return NULL;
+        }
     }
 }
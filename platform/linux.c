@@ -0,0 +1,72 @@
+#include <errno.h>
+#include <pwd.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "log.h"
+#include "platform.h"
+
+/*  Everything else is shared with macOS in posix.c */
+
+void platform_init(int argc, char** argv) {
+    (void)argc;
+    (void)argv;
+    /*  Nothing to do here:  there's no global menu bar on Linux */
+}
+
+void platform_window_bind(GLFWwindow* window) {
+    (void)window;
+}
+
+/*  Makes every directory along the given path, like mkdir -p.
+ *  The path is modified temporarily, but restored before returning. */
+static bool platform_mkdirs(char* path) {
+    for (char* c = path + 1; ; ++c) {
+        if (*c == '/' || *c == 0) {
+            const char prev = *c;
+            *c = 0;
+            const bool ok = !mkdir(path, 0700) || errno == EEXIST;
+            *c = prev;
+            if (!ok) {
+                log_error("Could not create %s (errno: %i)", path, errno);
+                return false;
+            } else if (!prev) {
+                return true;
+            }
+        }
+    }
+}
+
+/*  Follows the XDG base directory spec:  files are stored in
+ *  $XDG_DATA_HOME/states-machine, which defaults to
+ *  ~/.local/share/states-machine */
+char* platform_get_user_file(const char* file) {
+    const char* folder = "states-machine";
+    const char* base = getenv("XDG_DATA_HOME");
+    const char* suffix = "";
+
+    /*  The spec says that relative paths must be ignored */
+    if (!base || base[0] != '/') {
+        base = getenv("HOME");
+        if (!base || base[0] != '/') {
+            const struct passwd* pw = getpwuid(getuid());
+            base = pw ? pw->pw_dir : NULL;
+        }
+        if (!base) {
+            log_error("Could not find home directory");
+            return NULL;
+        }
+        suffix = "/.local/share";
+    }
+
+    const size_t len = strlen(base) + strlen(suffix) + 1 + strlen(folder)
+                     + 1 + strlen(file) + 1;
+    char* s = malloc(len);
+    snprintf(s, len, "%s%s/%s", base, suffix, folder);
+    if (!platform_mkdirs(s)) {
+        free(s);
+        return NULL;
+    }
+    snprintf(s, len, "%s%s/%s/%s", base, suffix, folder, file);
+    return s;
+}
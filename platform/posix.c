@@ -1,9 +1,9 @@
 #include <errno.h>
 #include <fcntl.h>
 #include <pthread.h>
-#include <sys/time.h>
 #include <sys/stat.h>
 #include <sys/mman.h>
+#include <time.h>
 #include <unistd.h>
 
 #include "log.h"
@@ -54,11 +54,16 @@ size_t platform_mmap_size(platform_mmap_t* m) {
     return m->size;
 }
 
-int64_t platform_get_time() {
-    static struct timeval t;
-    gettimeofday(&t, NULL);
+int64_t platform_get_time_ns(void) {
+    struct timespec t;
+    if (clock_gettime(CLOCK_MONOTONIC, &t)) {
+        log_error_and_abort("clock_gettime failed (errno: %i)", errno);
+    }
+    return t.tv_sec * 1000000000LL + t.tv_nsec;
+}
 
-    return t.tv_sec * 1000000 + t.tv_usec;
+int64_t platform_get_time(void) {
+    return platform_get_time_ns() / 1000;
 }
 
 void platform_set_terminal_color(FILE* f, platform_terminal_color_t c) {
@@ -127,6 +132,11 @@ int platform_cond_broadcast(platform_cond_t* cond) {
     return pthread_cond_broadcast(&cond->data);
 }
 
+unsigned platform_cpu_count(void) {
+    const long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return (n > 0) ? n : 1;
+}
+
 platform_thread_t* platform_thread_new(void *(*run)(void *), void* data)
 {
     OBJECT_ALLOC(platform_thread);
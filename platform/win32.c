@@ -18,13 +18,24 @@
 #define GLFW_EXPOSE_NATIVE_WIN32
 #include <GLFW/glfw3native.h>
 
+int64_t platform_get_time_ns(void) {
+    /*  The counter frequency is fixed at boot, so it only needs to be
+     *  read once (and racing to read it is harmless) */
+    static LARGE_INTEGER freq = {.QuadPart = 0};
+    if (!freq.QuadPart) {
+        QueryPerformanceFrequency(&freq);
+    }
+    LARGE_INTEGER t;
+    QueryPerformanceCounter(&t);
+
+    /*  Split into seconds and remainder to avoid overflow */
+    const int64_t s = t.QuadPart / freq.QuadPart;
+    const int64_t r = t.QuadPart % freq.QuadPart;
+    return s * 1000000000LL + r * 1000000000LL / freq.QuadPart;
+}
+
 int64_t platform_get_time(void) {
-    FILETIME t;
-    GetSystemTimePreciseAsFileTime(&t);
-    LARGE_INTEGER i;
-    i.LowPart = t.dwLowDateTime;
-    i.HighPart = t.dwHighDateTime;
-    return i.QuadPart / 10;
+    return platform_get_time_ns() / 1000;
 }
 
 void platform_set_terminal_color(FILE* f, platform_terminal_color_t c) {
@@ -135,6 +146,12 @@ int platform_thread_join(platform_thread_t* thread) {
     return WaitForSingleObject(thread->data, INFINITE);
 }
 
+unsigned platform_cpu_count(void) {
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors ? info.dwNumberOfProcessors : 1;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 void platform_init(int argc, char** argv) {
@@ -179,7 +196,7 @@ const char* platform_filename(const char* filepath) {
     return PathFindFileNameA(filepath);
 }
 
-const char* platform_get_user_file(const char* file) {
+char* platform_get_user_file(const char* file) {
     PWSTR out = NULL;
     SHGetKnownFolderPath(
         &FOLDERID_RoamingAppData,
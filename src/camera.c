@@ -5,18 +5,26 @@
 #include "shader.h"
 #include "mat.h"
 
-/*  Animation to change something about the camera */
+/*  Camera properties which can be animated.  Each property has a single
+ *  track, so starting a new animation on a property that's already moving
+ *  retargets it from its current value.  Scale is animated in log space,
+ *  so that zooming proceeds at a steady rate. */
+typedef enum {
+    CAMERA_TRACK_LENS,
+    CAMERA_TRACK_CENTER,
+    CAMERA_TRACK_SCALE,
+    CAMERA_TRACK_COUNT,
+} camera_track_type_t;
+
 typedef struct {
-    enum {
-        CAMERA_ANIM_LENS
-    } type;
+    bool active;
 
-    vec3_t start_pos;
-    vec3_t end_pos;
+    vec3_t start;
+    vec3_t end;
 
-    int64_t start_time;
-    int64_t total_time_ms;
-} anim_t;
+    int64_t start_time_ns;
+    int64_t duration_ns;
+} camera_track_t;
 
 struct camera_ {
     /*  Window parameters */
@@ -36,9 +44,18 @@ struct camera_ {
     vec3_t center;
     float scale;
 
-    /*  Calculated matrices */
+    /*  Calculated matrices, which are updated lazily when their bit
+     *  in dirty is set (see camera_invalidate) */
     mat4_t proj;
     mat4_t view;
+    mat4_t vp;
+    mat4_t vpi;
+    mat4_t mvp;
+    unsigned dirty;
+
+    /*  Incremented whenever any matrix changes, so that bound
+     *  uniforms can tell when they need to be re-uploaded */
+    uint32_t generation;
 
     /* Matrix calculated in loader and stored in model */
     mat4_t model;
@@ -56,11 +73,30 @@ struct camera_ {
 
     bool did_drag;
 
-    anim_t* anim;
+    camera_track_t tracks[CAMERA_TRACK_COUNT];
 };
 
+/*  Dirty bits for the derived matrices */
+#define CAMERA_DIRTY_PROJ   1
+#define CAMERA_DIRTY_VIEW   2
+#define CAMERA_DIRTY_VP     4
+#define CAMERA_DIRTY_VPI    8
+#define CAMERA_DIRTY_MVP   16
+
 ////////////////////////////////////////////////////////////////////////////////
 
+/*  Marks matrices as out-of-date, along with everything derived from them */
+static void camera_invalidate(camera_t* camera, unsigned dirty) {
+    if (dirty & (CAMERA_DIRTY_PROJ | CAMERA_DIRTY_VIEW)) {
+        dirty |= CAMERA_DIRTY_VP;
+    }
+    if (dirty & CAMERA_DIRTY_VP) {
+        dirty |= CAMERA_DIRTY_VPI | CAMERA_DIRTY_MVP;
+    }
+    camera->dirty |= dirty;
+    camera->generation++;
+}
+
 /*  Updates the proj matrix from width and height */
 static void camera_update_proj(camera_t* camera) {
     camera->proj = mat4_identity();
@@ -76,10 +112,8 @@ static void camera_update_proj(camera_t* camera) {
 
 /*  Recalculates the view matrix */
 static void camera_update_view(camera_t* camera) {
-    camera->view = mat4_identity();
-
     /* Apply translation */
-    camera->view = mat4_mul(camera->view, mat4_translation(camera->center));
+    camera->view = mat4_translation(camera->center);
 
     {   /* Apply the yaw rotation */
         const float c = cos(camera->yaw);
@@ -88,7 +122,7 @@ static void camera_update_view(camera_t* camera) {
                            { s,    c,   0.0f, 0.0f},
                            {0.0f, 0.0f, 1.0f, 0.0f},
                            {0.0f, 0.0f, 0.0f, 1.0f}}};
-        camera->view = mat4_mul(camera->view, y);
+        camera->view = mat4_mul(&camera->view, &y);
     }
     {   /* Apply the pitch rotation */
         const float c = cos(camera->pitch);
@@ -97,13 +131,48 @@ static void camera_update_view(camera_t* camera) {
                            {0.0f,  c,   -s,   0.0f},
                            {0.0f,  s,    c,   0.0f},
                            {0.0f, 0.0f, 0.0f, 1.0f}}};
-        camera->view = mat4_mul(camera->view, p);
+        camera->view = mat4_mul(&camera->view, &p);
     }
 
     {   /*  Apply the scaling */
         mat4_t s = mat4_scaling(1.0f / camera->scale);
-        camera->view = mat4_mul(camera->view, s);
+        camera->view = mat4_mul(&camera->view, &s);
+    }
+}
+
+/*  Returns the view + projection matrix, recalculating as needed */
+static const mat4_t* camera_vp_mat(camera_t* camera) {
+    if (camera->dirty & CAMERA_DIRTY_PROJ) {
+        camera_update_proj(camera);
+    }
+    if (camera->dirty & CAMERA_DIRTY_VIEW) {
+        camera_update_view(camera);
+    }
+    if (camera->dirty & CAMERA_DIRTY_VP) {
+        camera->vp = mat4_mul(&camera->view, &camera->proj);
+    }
+    camera->dirty &= ~(CAMERA_DIRTY_PROJ | CAMERA_DIRTY_VIEW | CAMERA_DIRTY_VP);
+    return &camera->vp;
+}
+
+/*  Finds the inverse of the view + projection matrix.  This
+ *  turns normalized mouse coordinates (in the +/- 1 range)
+ *  into world coordinates. */
+static const mat4_t* camera_vpi_mat(camera_t* camera) {
+    if (camera->dirty & CAMERA_DIRTY_VPI) {
+        camera->vpi = mat4_inv(camera_vp_mat(camera));
+        camera->dirty &= ~CAMERA_DIRTY_VPI;
+    }
+    return &camera->vpi;
+}
+
+/*  Returns the combined model + view + projection matrix */
+static const mat4_t* camera_mvp_mat(camera_t* camera) {
+    if (camera->dirty & CAMERA_DIRTY_MVP) {
+        camera->mvp = mat4_mul(&camera->model, camera_vp_mat(camera));
+        camera->dirty &= ~CAMERA_DIRTY_MVP;
     }
+    return &camera->mvp;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -113,27 +182,30 @@ camera_t* camera_new(float width, float height) {
     camera->width = width;
     camera->height = height;
 
+    /*  Until told otherwise, assume this isn't a high-DPI display */
+    camera->fb_width = width;
+    camera->fb_height = height;
+
     /*  Avoids a division by 0 during initial construction */
     camera->scale = 1.0f;
 
     /*  Use an orthographic projection */
     camera->lens = 0.0f;
 
-    /*  Initialize matrices to a sane state */
-    camera_update_proj(camera);
-    camera_update_view(camera);
+    /*  Matrices are calculated on first use */
+    camera->model = mat4_identity();
+    camera_invalidate(camera, CAMERA_DIRTY_PROJ | CAMERA_DIRTY_VIEW);
     return camera;
 }
 
 void camera_delete(camera_t* camera) {
-    free(camera->anim);
     free(camera);
 }
 
 void camera_set_size(camera_t* camera, float width, float height) {
     camera->width = width;
     camera->height = height;
-    camera_update_proj(camera);
+    camera_invalidate(camera, CAMERA_DIRTY_PROJ);
 }
 
 void camera_set_fb_size(camera_t* camera, float width, float height) {
@@ -144,17 +216,24 @@ void camera_set_fb_size(camera_t* camera, float width, float height) {
 void camera_get_fb_pixel(camera_t* camera, int x, int y,
                          int* fx, int* fy)
 {
-    const float sx = camera->fb_width / camera->width;
-    const float sy = camera->fb_height / camera->height;
+    const float sx = camera->fb_width / (float)camera->width;
+    const float sy = camera->fb_height / (float)camera->height;
+
+    /*  Window coordinates start at the top, and framebuffer pixels at
+     *  the bottom, so row y maps to row (fb_height - 1) at the top */
+    *fx = floorf(x * sx);
+    *fy = camera->fb_height - 1 - (int)floorf(y * sy);
+}
 
-    *fx = x * sx;
-    *fy = camera->fb_height - y * sy;
+uint32_t camera_generation(camera_t* camera) {
+    return camera->generation;
 }
 
 void camera_set_model(camera_t* camera, float* center, float scale) {
     mat4_t t = mat4_translation(*(vec3_t*)center);
     mat4_t s = mat4_scaling(1.0f / scale);
-    camera->model = mat4_mul(t, s);
+    camera->model = mat4_mul(&t, &s);
+    camera_invalidate(camera, CAMERA_DIRTY_MVP);
 }
 
 void camera_set_mouse_pos(camera_t* camera, float x, float y) {
@@ -169,53 +248,104 @@ void camera_set_mouse_pos(camera_t* camera, float x, float y) {
         case CAMERA_PAN: {
             camera->did_drag = true;
             vec3_t v = {{camera->click_pos[0], camera->click_pos[1], 0.0f}};
-            v = mat4_apply(camera->drag_mat, v);
+            v = mat4_apply(&camera->drag_mat, v);
             vec3_t w = {{camera->mouse_pos[0], camera->mouse_pos[1], 0.0f}};
-            w = mat4_apply(camera->drag_mat, w);
+            w = mat4_apply(&camera->drag_mat, w);
             for (unsigned i=0; i < 3; ++i) {
                 camera->center.v[i] = camera->start.v[i] + v.v[i] - w.v[i];
             }
-            camera_update_view(camera);
+            camera_invalidate(camera, CAMERA_DIRTY_VIEW);
             break;
         }
     }
 }
 
-static void camera_set_anim(camera_t* camera, anim_t* anim) {
-    if (camera->anim) {
-        log_warn("Triggered an animation while another was running; skipping");
-        free(anim);
-    } else {
-        anim->start_time = platform_get_time();
-        camera->anim = anim;
+/*  Reads the current value of an animated property */
+static vec3_t camera_track_get(camera_t* camera, camera_track_type_t type) {
+    vec3_t v = {{0.0f, 0.0f, 0.0f}};
+    switch (type) {
+        case CAMERA_TRACK_LENS:     v.v[0] = camera->lens; break;
+        case CAMERA_TRACK_CENTER:   v = camera->center; break;
+        case CAMERA_TRACK_SCALE:    v.v[0] = logf(camera->scale); break;
+        case CAMERA_TRACK_COUNT:    break;
     }
+    return v;
 }
 
-static void camera_anim_lens(camera_t* camera, float target, int time_ms) {
-    OBJECT_ALLOC(anim);
-    anim->type = CAMERA_ANIM_LENS;
-    anim->start_pos.v[0] = camera->lens;
-    anim->end_pos.v[0] = target;
-    anim->total_time_ms = time_ms;
-    camera_set_anim(camera, anim);
+/*  Assigns an animated property, marking matrices as dirty */
+static void camera_track_set(camera_t* camera, camera_track_type_t type,
+                             vec3_t v)
+{
+    switch (type) {
+        case CAMERA_TRACK_LENS:
+            camera->lens = v.v[0];
+            camera_invalidate(camera, CAMERA_DIRTY_PROJ);
+            break;
+        case CAMERA_TRACK_CENTER:
+            camera->center = v;
+            camera_invalidate(camera, CAMERA_DIRTY_VIEW);
+            break;
+        case CAMERA_TRACK_SCALE:
+            camera->scale = expf(v.v[0]);
+            camera_invalidate(camera, CAMERA_DIRTY_PROJ | CAMERA_DIRTY_VIEW);
+            break;
+        case CAMERA_TRACK_COUNT: break;
+    }
+}
+
+/*  Starts (or retargets) the track for the given property */
+static void camera_track_start(camera_t* camera, camera_track_type_t type,
+                               vec3_t target, int time_ms)
+{
+    camera_track_t* track = &camera->tracks[type];
+    track->start = camera_track_get(camera, type);
+    track->end = target;
+    track->start_time_ns = platform_get_time_ns();
+    track->duration_ns = time_ms * 1000000LL;
+    track->active = memcmp(&track->start, &track->end, sizeof(vec3_t)) != 0;
+}
+
+/*  Stops any animation of the camera's position, e.g. when the user
+ *  starts to pan or zoom by hand.  The lens keeps animating. */
+static void camera_track_cancel_motion(camera_t* camera) {
+    camera->tracks[CAMERA_TRACK_CENTER].active = false;
+    camera->tracks[CAMERA_TRACK_SCALE].active = false;
+}
+
+/*  Cubic ease-in-out, mapping [0, 1] to [0, 1] */
+static float camera_ease(float t) {
+    if (t < 0.5f) {
+        return 4.0f * t * t * t;
+    } else {
+        const float u = 2.0f - 2.0f * t;
+        return 1.0f - u * u * u / 2.0f;
+    }
 }
 
 void camera_anim_proj_perspective(camera_t* camera) {
-    camera_anim_lens(camera, 0.5f, 100);
+    const vec3_t v = {{0.5f, 0.0f, 0.0f}};
+    camera_track_start(camera, CAMERA_TRACK_LENS, v, 100);
 }
 
 void camera_anim_proj_orthographic(camera_t* camera) {
-    camera_anim_lens(camera, 0.0f, 100);
+    const vec3_t v = {{0.0f, 0.0f, 0.0f}};
+    camera_track_start(camera, CAMERA_TRACK_LENS, v, 100);
 }
 
-/*  Finds the inverse of the view + projection matrix.  This
- *  turns normalized mouse coordinates (in the +/- 1 range)
- *  into world coordinates. */
-static mat4_t camera_vpi_mat(camera_t* camera) {
-    mat4_t m = mat4_identity();
-    m = mat4_mul(camera->proj, m);
-    m = mat4_mul(camera->view, m);
-    return mat4_inv(m);
+void camera_fly_to(camera_t* camera, const float* center, float scale) {
+    /*  Convert from model to world coordinates, then leave a margin */
+    const vec3_t c = mat4_apply(&camera->model, *(const vec3_t*)center);
+    const vec3_t s = {{logf(scale * camera->model.m[0][0] * 1.25f),
+                       0.0f, 0.0f}};
+    camera_track_start(camera, CAMERA_TRACK_CENTER, c, 400);
+    camera_track_start(camera, CAMERA_TRACK_SCALE, s, 400);
+}
+
+void camera_fly_home(camera_t* camera) {
+    /*  The home position is centered with a scale of 1 (log 0) */
+    const vec3_t zero = {{0.0f, 0.0f, 0.0f}};
+    camera_track_start(camera, CAMERA_TRACK_CENTER, zero, 400);
+    camera_track_start(camera, CAMERA_TRACK_SCALE, zero, 400);
 }
 
 void camera_begin_pan(camera_t* camera) {
@@ -223,9 +353,10 @@ void camera_begin_pan(camera_t* camera) {
         log_warn("Cannot start panning in state %i", camera->state);
         return;
     }
+    camera_track_cancel_motion(camera);
     memcpy(camera->click_pos, camera->mouse_pos, sizeof(camera->mouse_pos));
     camera->start = camera->center;
-    camera->drag_mat = camera_vpi_mat(camera);
+    camera->drag_mat = *camera_vpi_mat(camera);
     camera->state = CAMERA_PAN;
     camera->did_drag = false;
 }
@@ -236,73 +367,67 @@ bool camera_end_drag(camera_t* camera) {
 }
 
 void camera_zoom(camera_t* camera, float amount) {
+    camera_track_cancel_motion(camera);
     const vec3_t mouse = {{camera->mouse_pos[0], camera->mouse_pos[1], 0.0f}};
 
-    mat4_t mat = camera_vpi_mat(camera);
-    vec3_t before = mat4_apply(mat, mouse);
+    const vec3_t before = mat4_apply(camera_vpi_mat(camera), mouse);
 
     camera->scale *= powf(1.01f, amount);
-    camera_update_view(camera);
-    camera_update_proj(camera);
-
-    mat = camera_vpi_mat(camera);
-    vec3_t after = mat4_apply(mat, mouse);
+    camera_invalidate(camera, CAMERA_DIRTY_PROJ | CAMERA_DIRTY_VIEW);
+    const vec3_t after = mat4_apply(camera_vpi_mat(camera), mouse);
 
     for (unsigned i=0; i < 3; ++i) {
         camera->center.v[i] += before.v[i] - after.v[i];
     }
-    camera_update_view(camera);
+    camera_invalidate(camera, CAMERA_DIRTY_VIEW);
 }
 
 camera_uniforms_t camera_get_uniforms(GLuint prog) {
     camera_uniforms_t u;
-    SHADER_GET_UNIFORM(proj);
-    SHADER_GET_UNIFORM(view);
-    SHADER_GET_UNIFORM(model);
+    SHADER_GET_UNIFORM(mvp);
+    u.bound = NULL;
+    u.generation = 0;
     return u;
 }
 
-void camera_bind(camera_t* camera, camera_uniforms_t u) {
-    glUniformMatrix4fv(u.proj,  1, GL_FALSE, (float*)&camera->proj);
-    glUniformMatrix4fv(u.view,  1, GL_FALSE, (float*)&camera->view);
-    glUniformMatrix4fv(u.model, 1, GL_FALSE, (float*)&camera->model);
+void camera_bind(camera_t* camera, camera_uniforms_t* u) {
+    /*  Uniforms are per-program state, so they only need to be
+     *  uploaded again if the camera has changed */
+    if (u->bound == camera && u->generation == camera->generation) {
+        return;
+    }
+    glUniformMatrix4fv(u->mvp, 1, GL_FALSE, (float*)camera_mvp_mat(camera));
+    u->bound = camera;
+    u->generation = camera->generation;
 }
 
 bool camera_check_anim(camera_t* camera) {
-    if (!camera->anim) {
-        return false;
-    }
-
-    /*  Get the current time, for use in interpolation */
-    const int64_t t = platform_get_time();
-    if (t < camera->anim->start_time) {
-        log_error_and_abort("Invalid time in animation");
-    }
-
-    /*  Calculate an interpolated value */
-    float frac = (t - camera->anim->start_time) / camera->anim->total_time_ms
-                 / 1000.0f;
-    const bool done = (frac >= 1.0f);
-    if (done) {
-        frac = 1.0f;
-    }
-    vec3_t v;
-    for (unsigned i=0; i < 3; ++i) {
-        v.v[i] = camera->anim->start_pos.v[i] * (1.0f - frac) +
-                 camera->anim->end_pos.v[i] * frac;
-    }
+    /*  Calculate interpolated values, based on the (monotonic) time */
+    const int64_t now_ns = platform_get_time_ns();
+    bool running = false;
+    for (unsigned i=0; i < CAMERA_TRACK_COUNT; ++i) {
+        camera_track_t* track = &camera->tracks[i];
+        if (!track->active) {
+            continue;
+        }
+        const int64_t dt_ns = now_ns - track->start_time_ns;
+        float frac = dt_ns / (float)track->duration_ns;
+        if (frac >= 1.0f) {
+            frac = 1.0f;
+            track->active = false;
+        } else {
+            running = true;
+        }
+        frac = camera_ease(frac);
 
-    switch (camera->anim->type) {
-        case CAMERA_ANIM_LENS: {
-            camera->lens = v.v[0];
-            camera_update_proj(camera);
-       }
-    }
-    if (done) {
-        free(camera->anim);
-        camera->anim = NULL;
+        vec3_t v;
+        for (unsigned j=0; j < 3; ++j) {
+            v.v[j] = track->start.v[j] * (1.0f - frac) +
+                     track->end.v[j] * frac;
+        }
+        camera_track_set(camera, i, v);
     }
-    return !done;
+    return running;
 }
 
 float camera_aspect_ratio(camera_t* camera) {
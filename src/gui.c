@@ -3,8 +3,10 @@
 #include "object.h"
 #include "shader.h"
 #include "log.h"
+#include "platform.h"
+#include "timing.h"
+#include "trace.h"
 
-#include "stb/stb_rectpack.h"
 #include "stb/stb_truetype.h"
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -30,13 +32,17 @@ out vec4 out_color;
 void main() {
     float frag_shade = frag_tex.z;
     if (frag_shade >= 0.0f) {
-        float t = texture(tex, frag_tex.xy).r;
+        /*  The atlas stores signed distance fields, with the glyph edge
+         *  at 0.5.  Antialias over about one screen pixel, so that text
+         *  stays crisp at any scale.  Quads include the SDF padding, so
+         *  coverage goes into alpha to keep it from hiding neighbours. */
+        float d = texture(tex, frag_tex.xy).r;
+        float w = max(fwidth(d), 1e-4f);
+        float t = smoothstep(0.5f - w, 0.5f + w, d);
         float f = (1.0f - frag_shade);
         vec3 full_color = vec3(f, f, f);
-        vec3 white = vec3(1.0f, 1.0f, 1.0f);
-        vec3 delta = full_color - white;
 
-        out_color = vec4(white + delta * t, 1.0f);
+        out_color = vec4(full_color, t);
     } else if (frag_shade == -1.0f) {
         out_color = vec4(1.0f, 1.0f, 1.0f, 1.0f);
     } else if (frag_shade <= -1.99f) {
@@ -50,47 +56,149 @@ void main() {
 
 ////////////////////////////////////////////////////////////////////////////////
 
-const static unsigned FONT_IMAGE_SIZE = 1000;
+/*  Glyphs are stored as signed distance fields, rendered at
+ *  FONT_SDF_SIZE_PX, while layout is done in units of FONT_SIZE_PX */
+const static unsigned FONT_IMAGE_WIDTH = 512;
+const static unsigned FONT_IMAGE_HEIGHT = 256;
 const static unsigned FONT_SIZE_PX = 64;
+const static unsigned FONT_SDF_SIZE_PX = 32;
+const static int FONT_SDF_PADDING = 4;
+
+/*  The vertex buffer is a ring of fixed-size segments, each of which holds
+ *  one frame of vertices.  Each segment is guarded by a fence, so we never
+ *  write into a segment that the GPU is still reading. */
+#define GUI_SEGMENT_COUNT 3
+#define GUI_SEGMENT_VERTS 8192
+#define GUI_VERT_FLOATS 6
+
+/*  Laid-out strings are cached in a separate static vertex buffer, with
+ *  one fixed-size slot per string, so that unchanged text is drawn
+ *  without repeating any layout work.  A string is only cached once it's
+ *  been requested twice (text that changes every frame never repeats),
+ *  so we also remember the keys of recent uncached strings. */
+#define GUI_CACHE_SLOTS 16
+#define GUI_CACHE_SLOT_VERTS 2048
+#define GUI_CACHE_KEY_LENGTH 128
+#define GUI_CACHE_SEEN 32
+
+typedef struct {
+    /*  Cache key, hashed (along with the layout parameters) into hash */
+    uint64_t hash;
+    char str[GUI_CACHE_KEY_LENGTH];
+    float aspect_ratio;
+    float y_pos;
+    int pad_to;
+
+    /*  Number of vertices in this slot, or 0 if the slot is empty */
+    GLsizei count;
+
+    /*  Frame in which this slot was last drawn, for LRU eviction.  The
+     *  GPU may still be reading the slot until GUI_SEGMENT_COUNT frames
+     *  later, when gui_reset waits on that frame's fence. */
+    uint64_t frame;
+} gui_cache_entry_t;
+
+/*  A range of vertices to draw, from either the stream buffer or the
+ *  cache buffer.  Runs are drawn in the order that they were added. */
+typedef struct {
+    bool cached;
+    GLint first;
+    GLsizei count;
+} gui_run_t;
+
+struct gui_font_ {
+    stbtt_packedchar* chars;
+    uint8_t* pixels;
+};
+
 struct gui_ {
-    stbtt_pack_context context;
     stbtt_packedchar* chars;
 
+    /*  Points into the mapped segment of the vertex buffer between
+     *  gui_reset and gui_draw.  buf_index and buf_size count floats. */
     float* buf;
     size_t buf_index;
     size_t buf_size;
 
+    /*  Frames that dropped vertices since the last warning, and when that
+     *  warning was logged (warnings are limited to one per second) */
+    unsigned overflow_frames;
+    int64_t overflow_warn_ns;
+
+    unsigned segment;
+    GLsync fences[GUI_SEGMENT_COUNT];
+
+    /*  Transform applied to each vertex as it's pushed:
+     *  x' = (x + x_offset) * x_scale, y' = y * y_scale + y_offset */
+    float x_offset;
+    float x_scale;
+    float y_offset;
+    float y_scale;
+
+    /*  When set, layout runs without pushing vertices */
+    bool measuring;
+
+    /*  Set when a vertex is dropped because the target buffer is full */
+    bool full;
+
+    gui_cache_entry_t cache[GUI_CACHE_SLOTS];
+    unsigned cache_draws;
+    uint64_t cache_seen[GUI_CACHE_SEEN];
+    unsigned cache_seen_next;
+    uint64_t frame;
+
+    /*  Draw calls for this frame, which keep everything in call order:
+     *  each cached string ends the current run of streamed vertices
+     *  (which started at run_start, in floats) and adds its own run. */
+    gui_run_t runs[2 * GUI_CACHE_SLOTS + 1];
+    unsigned run_count;
+    size_t run_start;
+
     GLuint vao;
     GLuint vbo;
+    GLuint cache_vao;
+    GLuint cache_vbo;
     GLuint tex;
 
     shader_t shader;
     GLint u_tex;
+
+    /*  If set, the glyph table, font texture, and program belong to
+     *  another GUI.  Vertex buffers are always our own, since they're
+     *  rewritten every frame. */
+    bool shared;
 };
 
 ////////////////////////////////////////////////////////////////////////////////
 
-static void gui_push(gui_t* gui, float t) {
-    if (gui->buf_index >= gui->buf_size) {
-        if (gui->buf_size) {
-            gui->buf_size *= 2;
-        } else {
-            gui->buf_size = 32;
-        }
-        gui->buf = realloc(gui->buf, gui->buf_size * sizeof(float));
-    }
-    gui->buf[gui->buf_index++] = t;
+static void gui_set_transform(gui_t* gui, float x_offset, float x_scale,
+                              float y_offset, float y_scale)
+{
+    gui->x_offset = x_offset;
+    gui->x_scale = x_scale;
+    gui->y_offset = y_offset;
+    gui->y_scale = y_scale;
 }
 
+/*  Writes a vertex directly into mapped memory.  The buffer has a fixed
+ *  size, so vertices beyond its capacity are dropped. */
 static void gui_push_vert(gui_t* gui, float x, float y, float z,
                                       float s, float t, float p)
 {
-    gui_push(gui, x);
-    gui_push(gui, y);
-    gui_push(gui, z);
-    gui_push(gui, s);
-    gui_push(gui, t);
-    gui_push(gui, p);
+    if (gui->measuring) {
+        return;
+    } else if (gui->buf_index + GUI_VERT_FLOATS > gui->buf_size) {
+        gui->full = true;
+        return;
+    }
+    float* v = &gui->buf[gui->buf_index];
+    v[0] = (x + gui->x_offset) * gui->x_scale;
+    v[1] = y * gui->y_scale + gui->y_offset;
+    v[2] = z;
+    v[3] = s;
+    v[4] = t;
+    v[5] = p;
+    gui->buf_index += GUI_VERT_FLOATS;
 }
 
 static void gui_push_quad(gui_t* gui, stbtt_aligned_quad q, float z, float p) {
@@ -103,86 +211,230 @@ static void gui_push_quad(gui_t* gui, stbtt_aligned_quad q, float z, float p) {
     gui_push_vert(gui, q.x1, q.y1, z, q.s1, q.t1, p);
 }
 
+/*  Builds a VAO with the GUI's vertex layout, reading from the given VBO */
+static GLuint gui_vao_new(GLuint vbo) {
+    GLuint vao;
+    glGenVertexArrays(1, &vao);
+    glBindVertexArray(vao);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(
+            0, 3, GL_FLOAT, GL_FALSE, GUI_VERT_FLOATS * sizeof(float), 0);
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(
+            1, 3, GL_FLOAT, GL_FALSE, GUI_VERT_FLOATS * sizeof(float),
+            (void*)(3 * sizeof(float)));
+    return vao;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
-gui_t* gui_new() {
-    OBJECT_ALLOC(gui);
+/*  Renders a signed distance field for each printable character and packs
+ *  them into rows of the atlas, filling in font->chars so that glyphs can
+ *  be laid out with stbtt_GetPackedQuad. */
+gui_font_t* gui_font_new(void) {
+    TRACE_BEGIN("gui_font_new");
+    OBJECT_ALLOC(gui_font);
 
-    uint8_t* pixels = malloc(FONT_IMAGE_SIZE * FONT_IMAGE_SIZE);
-    if (!stbtt_PackBegin(&gui->context, pixels,
-                         FONT_IMAGE_SIZE, FONT_IMAGE_SIZE,
-                         0, 1, NULL))
-    {
-        log_error_and_abort("stbtt_PackBegin failed");
+    stbtt_fontinfo info;
+    if (!stbtt_InitFont(&info, FONT, 0)) {
+        log_error_and_abort("stbtt_InitFont failed");
     }
-    stbtt_PackSetOversampling(&gui->context, 2, 2);
-
-    size_t num_chars = '~' - ' ';
-    gui->chars = malloc(sizeof(stbtt_packedchar) * num_chars);
+    const float sdf_scale = stbtt_ScaleForPixelHeight(&info, FONT_SDF_SIZE_PX);
+    const float layout_scale = stbtt_ScaleForPixelHeight(&info, FONT_SIZE_PX);
+    const float k = FONT_SIZE_PX / (float)FONT_SDF_SIZE_PX;
+
+    uint8_t* pixels = calloc(FONT_IMAGE_WIDTH * FONT_IMAGE_HEIGHT, 1);
+    const size_t num_chars = '~' - ' ';
+    stbtt_packedchar* chars = calloc(num_chars, sizeof(stbtt_packedchar));
+
+    unsigned x = 1;
+    unsigned y = 1;
+    unsigned row_height = 0;
+    for (unsigned i=0; i < num_chars; ++i) {
+        stbtt_packedchar* c = &chars[i];
+
+        int advance, lsb;
+        stbtt_GetCodepointHMetrics(&info, ' ' + i, &advance, &lsb);
+        c->xadvance = advance * layout_scale;
+
+        /*  The edge is at 128, and values fall off to 0 (or rise to 255)
+         *  at the edge of the padding */
+        int w, h, xoff, yoff;
+        uint8_t* sdf = stbtt_GetCodepointSDF(
+                &info, sdf_scale, ' ' + i, FONT_SDF_PADDING,
+                128, 128.0f / FONT_SDF_PADDING, &w, &h, &xoff, &yoff);
+        if (!sdf) {
+            continue;   /* Empty glyph, e.g. the space character */
+        }
 
-    if (!stbtt_PackFontRange(&gui->context, FONT, 0, FONT_SIZE_PX, ' ',
-                             num_chars, gui->chars))
-    {
-        log_error_and_abort("stbtt_PackFontRange failed");
+        if (x + w + 1 > FONT_IMAGE_WIDTH) {
+            x = 1;
+            y += row_height + 1;
+            row_height = 0;
+        }
+        if (y + h + 1 > FONT_IMAGE_HEIGHT) {
+            log_error_and_abort("Font atlas is too small");
+        }
+        for (int j=0; j < h; ++j) {
+            memcpy(&pixels[(y + j) * FONT_IMAGE_WIDTH + x], &sdf[j * w], w);
+        }
+        stbtt_FreeSDF(sdf, NULL);
+
+        c->x0 = x;
+        c->y0 = y;
+        c->x1 = x + w;
+        c->y1 = y + h;
+        c->xoff = xoff * k;
+        c->yoff = yoff * k;
+        c->xoff2 = (xoff + w) * k;
+        c->yoff2 = (yoff + h) * k;
+
+        x += w + 1;
+        if ((unsigned)h > row_height) {
+            row_height = h;
+        }
     }
-    stbtt_PackEnd(&gui->context);
+    gui_font->chars = chars;
+    gui_font->pixels = pixels;
+    TRACE_END("gui_font_new");
+    return gui_font;
+}
 
-    glGenTextures(1, &gui->tex);
-    glBindTexture(GL_TEXTURE_2D, gui->tex);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RED, FONT_IMAGE_SIZE, FONT_IMAGE_SIZE,
-                 0, GL_RED, GL_UNSIGNED_BYTE, pixels);
-    log_gl_error();
-    free(pixels);
+gui_t* gui_new(gui_font_t* font, const gui_t* share) {
+    TRACE_BEGIN("gui_new");
+    OBJECT_ALLOC(gui);
+
+    if (share) {
+        gui->chars = share->chars;
+        gui->tex = share->tex;
+        gui->shader = share->shader;
+        gui->u_tex = share->u_tex;
+        gui->shared = true;
+    } else {
+        glGenTextures(1, &gui->tex);
+        glBindTexture(GL_TEXTURE_2D, gui->tex);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_R8,
+                     FONT_IMAGE_WIDTH, FONT_IMAGE_HEIGHT,
+                     0, GL_RED, GL_UNSIGNED_BYTE, font->pixels);
+        log_gl_error();
+
+        /*  Keep the glyph table, but we're done with the atlas pixels */
+        gui->chars = font->chars;
+        free(font->pixels);
+        free(font);
+
+        gui->shader = shader_new(GUI_VS_SRC, NULL, GUI_FS_SRC);
+        {   /* Make a temporary struct to unpack local uniforms */
+            GLint prog = gui->shader.prog;
+            struct { GLint tex; } u;
+            SHADER_GET_UNIFORM(tex);
+            gui->u_tex = u.tex;
+        }
+    }
 
     glGenBuffers(1, &gui->vbo);
     glBindBuffer(GL_ARRAY_BUFFER, gui->vbo);
-
-    glGenVertexArrays(1, &gui->vao);
-    glBindVertexArray(gui->vao);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(
-            0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), 0);
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(
-            1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float),
-            (void*)(3 * sizeof(float)));
-
-    gui->shader = shader_new(GUI_VS_SRC, NULL, GUI_FS_SRC);
-    glUseProgram(gui->shader.prog);
-
-    {   /* Make a temporary struct to unpack local uniforms */
-        GLint prog = gui->shader.prog;
-        struct { GLint tex; } u;
-        SHADER_GET_UNIFORM(tex);
-        gui->u_tex = u.tex;
-    }
+    glBufferData(GL_ARRAY_BUFFER,
+                 GUI_SEGMENT_COUNT * GUI_SEGMENT_VERTS *
+                 GUI_VERT_FLOATS * sizeof(float),
+                 NULL, GL_STREAM_DRAW);
+    gui->vao = gui_vao_new(gui->vbo);
+
+    glGenBuffers(1, &gui->cache_vbo);
+    glBindBuffer(GL_ARRAY_BUFFER, gui->cache_vbo);
+    glBufferData(GL_ARRAY_BUFFER,
+                 GUI_CACHE_SLOTS * GUI_CACHE_SLOT_VERTS *
+                 GUI_VERT_FLOATS * sizeof(float),
+                 NULL, GL_STATIC_DRAW);
+    gui->cache_vao = gui_vao_new(gui->cache_vbo);
     log_gl_error();
 
+    TRACE_END("gui_new");
     return gui;
 }
 
 void gui_delete(gui_t* gui) {
-    free(gui->chars);
-    free(gui->buf);
-    glDeleteTextures(1, &gui->tex);
+    if (gui->buf) {
+        glBindBuffer(GL_ARRAY_BUFFER, gui->vbo);
+        glUnmapBuffer(GL_ARRAY_BUFFER);
+    }
+    for (unsigned i=0; i < GUI_SEGMENT_COUNT; ++i) {
+        if (gui->fences[i]) {
+            glDeleteSync(gui->fences[i]);
+        }
+    }
     glDeleteBuffers(1, &gui->vbo);
     glDeleteVertexArrays(1, &gui->vao);
-    shader_deinit(gui->shader);
+    glDeleteBuffers(1, &gui->cache_vbo);
+    glDeleteVertexArrays(1, &gui->cache_vao);
+    if (!gui->shared) {
+        free(gui->chars);
+        glDeleteTextures(1, &gui->tex);
+        shader_deinit(gui->shader);
+    }
     free(gui);
 }
 
 void gui_reset(gui_t* gui) {
+    TRACE_BEGIN("gui_reset");
+    glBindBuffer(GL_ARRAY_BUFFER, gui->vbo);
+    if (gui->buf) {
+        glUnmapBuffer(GL_ARRAY_BUFFER);
+    }
+
+    /*  Move to the next segment, waiting until the GPU is done with it.
+     *  With three segments in the ring, this should rarely block. */
+    gui->segment = (gui->segment + 1) % GUI_SEGMENT_COUNT;
+    GLsync* fence = &gui->fences[gui->segment];
+    if (*fence) {
+        GLenum r;
+        do {
+            r = glClientWaitSync(*fence, GL_SYNC_FLUSH_COMMANDS_BIT,
+                                 1000000000);
+        } while (r == GL_TIMEOUT_EXPIRED);
+        if (r == GL_WAIT_FAILED) {
+            log_error("Failed to wait on GUI fence");
+        }
+        glDeleteSync(*fence);
+        *fence = NULL;
+    }
+
+    /*  The fence already synchronized us, so the driver doesn't need to */
+    const size_t size = GUI_SEGMENT_VERTS * GUI_VERT_FLOATS;
+    gui->buf = glMapBufferRange(GL_ARRAY_BUFFER,
+            gui->segment * size * sizeof(float), size * sizeof(float),
+            GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT |
+            GL_MAP_UNSYNCHRONIZED_BIT);
+    if (!gui->buf) {
+        log_error("Failed to map GUI vertex buffer");
+    }
     gui->buf_index = 0;
+    gui->buf_size = gui->buf ? size : 0;
+    gui->full = false;
+    gui_set_transform(gui, 0.0f, 1.0f, 0.0f, 1.0f);
+
+    gui->cache_draws = 0;
+    gui->run_count = 0;
+    gui->run_start = 0;
+    gui->frame++;
+    TRACE_END("gui_reset");
 }
 
 void gui_backdrop(gui_t* gui, float aspect_ratio) {
+    gui_panel(gui, aspect_ratio, 0.55f, 0.90f);
+}
+
+void gui_panel(gui_t* gui, float aspect_ratio, float y0, float y1) {
     stbtt_aligned_quad q;
     q.x0 = -0.8;
     q.x1 = 0.8;
-    q.y0 = 0.55;
-    q.y1 = 0.90;
+    q.y0 = y0;
+    q.y1 = y1;
 
     const float z = 0.75f;
     gui_push_quad(gui, q, z, -1.0f);
@@ -255,6 +507,9 @@ void gui_backdrop(gui_t* gui, float aspect_ratio) {
 void gui_draw_squircle(gui_t* gui, float x, float y, float z,
                        float s, float r, float a)
 {
+    if (gui->measuring) {
+        return;
+    }
 #define SQUIRCLE_VERTS 64
     float angle[SQUIRCLE_VERTS];
     float rho[SQUIRCLE_VERTS];
@@ -280,19 +535,18 @@ void gui_draw_squircle(gui_t* gui, float x, float y, float z,
 #undef SQUIRCLE_VERTS
 }
 
-void gui_print(gui_t* gui, const char* s,
-               float aspect_ratio, float y_pos,
-               int pad_to)
-{
+/*  Lays out a string in font pixel units, pushing vertices through the
+ *  current transform.  Returns the final x position (i.e. the width). */
+static float gui_layout(gui_t* gui, const char* s, int pad_to) {
     float x = 0.0f;
     float y = 0.0f;
     float shade = 1.0f;
 
-    // Record the starting index
-    unsigned j = gui->buf_index;
     float underline_x = -5.0f;
     float underline_y = -5.0f;
+    float underline_end = -5.0f;
     int underlined_count = -1;
+    float cursor_x = -5.0f;
     bool draw_squircle = false;
     while (*s) {
         if (*s == 1) {
@@ -305,10 +559,11 @@ void gui_print(gui_t* gui, const char* s,
             underline_y = y;
             underlined_count = 0;
         } else if (*s == 4) {
-            // Add cursor line
+            // Add cursor line (before any ghost text)
+            const float cx = (cursor_x != -5.0f) ? cursor_x : x;
             stbtt_aligned_quad q;
-            q.x0 = x + FONT_SIZE_PX * 0.05f;
-            q.x1 = x + FONT_SIZE_PX * 0.1f;
+            q.x0 = cx + FONT_SIZE_PX * 0.05f;
+            q.x1 = cx + FONT_SIZE_PX * 0.1f;
             q.y0 = underline_y + FONT_SIZE_PX * 0.1f;
             q.y1 = underline_y - FONT_SIZE_PX * 0.7f;
             gui_push_quad(gui, q, 0.5f, -2.5f);
@@ -317,18 +572,23 @@ void gui_print(gui_t* gui, const char* s,
             while (underlined_count++ <= pad_to) {
                 stbtt_aligned_quad q;
                 stbtt_GetPackedQuad(
-                        gui->chars, FONT_IMAGE_SIZE, FONT_IMAGE_SIZE,
+                        gui->chars, FONT_IMAGE_WIDTH, FONT_IMAGE_HEIGHT,
                         0, &x, &y, &q, 0);
                 gui_push_quad(gui, q, 0.5f, shade);
             }
+            underline_end = x;
         } else if (*s == 5) {
             draw_squircle = true;
         } else if (*s == 6) {
             shade = 0.2f;
+        } else if (*s == 7) {
+            // Begin ghost text (e.g. autocomplete), placing the cursor here
+            cursor_x = x;
+            shade = 0.25f;
         } else {
             stbtt_aligned_quad q;
             stbtt_GetPackedQuad(
-                    gui->chars, FONT_IMAGE_SIZE, FONT_IMAGE_SIZE,
+                    gui->chars, FONT_IMAGE_WIDTH, FONT_IMAGE_HEIGHT,
                     *s - ' ', &x, &y, &q, 0);
             gui_push_quad(gui, q, 0.5f, shade);
             if (underlined_count >= 0) {
@@ -347,35 +607,221 @@ void gui_print(gui_t* gui, const char* s,
     if (underline_x != -5.0f) {
         stbtt_aligned_quad q;
         q.x0 = underline_x;
-        q.x1 = x;
+        q.x1 = (underline_end != -5.0f) ? underline_end : x;
         q.y0 = underline_y + FONT_SIZE_PX * 0.3;
         q.y1 = underline_y + FONT_SIZE_PX * 0.25;
         gui_push_quad(gui, q, 0.5f, -3.0f);
     }
+    return x;
+}
+
+/*  Lays out a string centered at the given height, writing into
+ *  whichever buffer is currently targeted */
+static void gui_print_layout(gui_t* gui, const char* s,
+                             float aspect_ratio, float y_pos,
+                             int pad_to)
+{
+    TIMING_BEGIN(gui_layout);
+
+    /*  Measure the string first, so that vertices can be centered
+     *  as they're written (rather than reading back mapped memory) */
+    gui->measuring = true;
+    const float width = gui_layout(gui, s, pad_to);
+    gui->measuring = false;
 
-    x /= 2.0f;  // Prepare to center the text
     const float scale = 0.1f / FONT_SIZE_PX;
-    for (/*j is initial index*/; j < gui->buf_index; j += 6) {
-        gui->buf[j] = (gui->buf[j] - x) * scale / aspect_ratio;
-        gui->buf[j + 1] = -gui->buf[j + 1] * scale + y_pos;
+    gui_set_transform(gui, -width / 2.0f, scale / aspect_ratio,
+                      y_pos, -scale);
+    gui_layout(gui, s, pad_to);
+    gui_set_transform(gui, 0.0f, 1.0f, 0.0f, 1.0f);
+
+    TIMING_END(gui_layout);
+}
+
+/*  Looks up a string in the layout cache.  On a miss, a string that was
+ *  requested recently is laid out into a free (or least-recently-used)
+ *  slot, while any other string is only remembered.  Returns the slot
+ *  index, or -1 if the string isn't cached. */
+static int gui_cache_find(gui_t* gui, const char* s,
+                          float aspect_ratio, float y_pos, int pad_to)
+{
+    uint64_t hash = 14695981039346656037ULL;
+    size_t len = 0;
+    for (const char* c=s; *c; ++c, ++len) {
+        hash ^= (uint8_t)*c;
+        hash *= 1099511628211ULL;
+    }
+    const struct { float aspect_ratio, y_pos; int pad_to; } params = {
+        aspect_ratio, y_pos, pad_to };
+    for (size_t i=0; i < sizeof(params); ++i) {
+        hash ^= ((const uint8_t*)&params)[i];
+        hash *= 1099511628211ULL;
+    }
+    if (len >= GUI_CACHE_KEY_LENGTH ||
+        gui->cache_draws == GUI_CACHE_SLOTS)
+    {
+        return -1;
     }
+
+    int victim = -1;
+    for (unsigned i=0; i < GUI_CACHE_SLOTS; ++i) {
+        gui_cache_entry_t* e = &gui->cache[i];
+        if (e->count && e->hash == hash && e->aspect_ratio == aspect_ratio &&
+            e->y_pos == y_pos && e->pad_to == pad_to && !strcmp(e->str, s))
+        {
+            return i;
+        }
+        /*  Slots that the GPU may still be reading can't be evicted */
+        if ((!e->count || e->frame + GUI_SEGMENT_COUNT <= gui->frame) &&
+            (victim == -1 || !e->count ||
+             (gui->cache[victim].count && e->frame < gui->cache[victim].frame)))
+        {
+            victim = i;
+        }
+    }
+
+    /*  Only cache strings that have been seen before */
+    unsigned seen = 0;
+    while (seen < GUI_CACHE_SEEN && gui->cache_seen[seen] != hash) {
+        seen++;
+    }
+    if (seen == GUI_CACHE_SEEN) {
+        gui->cache_seen[gui->cache_seen_next] = hash;
+        gui->cache_seen_next = (gui->cache_seen_next + 1) % GUI_CACHE_SEEN;
+        return -1;
+    } else if (victim == -1) {
+        return -1;
+    }
+    gui->cache_seen[seen] = 0;
+
+    /*  Redirect vertex output into the victim's slot.  The stream buffer
+     *  stays mapped, so we map the static buffer through another target.
+     *  The GPU is done with the slot (see above), so the driver doesn't
+     *  need to synchronize. */
+    float* const buf = gui->buf;
+    const size_t buf_index = gui->buf_index;
+    const size_t buf_size = gui->buf_size;
+    const bool full = gui->full;
+
+    const size_t size = GUI_CACHE_SLOT_VERTS * GUI_VERT_FLOATS;
+    glBindBuffer(GL_COPY_WRITE_BUFFER, gui->cache_vbo);
+    gui->buf = glMapBufferRange(GL_COPY_WRITE_BUFFER,
+            victim * size * sizeof(float), size * sizeof(float),
+            GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT |
+            GL_MAP_UNSYNCHRONIZED_BIT);
+    gui->buf_index = 0;
+    gui->buf_size = gui->buf ? size : 0;
+    gui->full = false;
+
+    gui_print_layout(gui, s, aspect_ratio, y_pos, pad_to);
+
+    gui_cache_entry_t* e = &gui->cache[victim];
+    const bool ok = gui->buf && !gui->full &&
+                    glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+    e->count = ok ? (gui->buf_index / GUI_VERT_FLOATS) : 0;
+    e->hash = hash;
+    memcpy(e->str, s, len + 1);
+    e->aspect_ratio = aspect_ratio;
+    e->y_pos = y_pos;
+    e->pad_to = pad_to;
+
+    gui->buf = buf;
+    gui->buf_index = buf_index;
+    gui->buf_size = buf_size;
+    gui->full = full;
+    return ok ? victim : -1;
+}
+
+/*  Ends the current run of streamed vertices, if it isn't empty */
+static void gui_end_stream_run(gui_t* gui) {
+    if (gui->buf_index > gui->run_start) {
+        gui->runs[gui->run_count++] = (gui_run_t){
+            .cached = false,
+            .first = gui->segment * GUI_SEGMENT_VERTS +
+                     gui->run_start / GUI_VERT_FLOATS,
+            .count = (gui->buf_index - gui->run_start) / GUI_VERT_FLOATS,
+        };
+        gui->run_start = gui->buf_index;
+    }
+}
+
+void gui_print(gui_t* gui, const char* s,
+               float aspect_ratio, float y_pos,
+               int pad_to)
+{
+    TRACE_BEGIN("gui_print");
+    const int slot = gui_cache_find(gui, s, aspect_ratio, y_pos, pad_to);
+    if (slot >= 0) {
+        gui->cache[slot].frame = gui->frame;
+        gui_end_stream_run(gui);
+        gui->runs[gui->run_count++] = (gui_run_t){
+            .cached = true,
+            .first = slot * GUI_CACHE_SLOT_VERTS,
+            .count = gui->cache[slot].count,
+        };
+        gui->cache_draws++;
+    } else {
+        gui_print_layout(gui, s, aspect_ratio, y_pos, pad_to);
+    }
+    TRACE_END("gui_print");
 }
 
 void gui_draw(gui_t* gui) {
+    TRACE_BEGIN("gui_draw");
     glUseProgram(gui->shader.prog);
     glBindVertexArray(gui->vao);
     glBindBuffer(GL_ARRAY_BUFFER, gui->vbo);
-    glBufferData(GL_ARRAY_BUFFER, gui->buf_index * sizeof(float),
-                 gui->buf, GL_DYNAMIC_DRAW);
+    if (!gui->buf) {
+        TRACE_END("gui_draw");
+        return;
+    }
+    gui->buf = NULL;
+
+    /*  If the buffer contents were lost (e.g. due to a display mode
+     *  change), then skip drawing this frame. */
+    if (!glUnmapBuffer(GL_ARRAY_BUFFER)) {
+        log_warn("GUI vertex buffer was corrupted");
+        TRACE_END("gui_draw");
+        return;
+    }
 
     glActiveTexture(GL_TEXTURE0);
     glBindTexture(GL_TEXTURE_2D, gui->tex);
     glUniform1i(gui->u_tex, 0);
     log_gl_error();
 
+    /*  Runs are drawn in call order and nothing in the GUI writes depth,
+     *  so later calls are drawn on top.  Glyph quads overlap their
+     *  neighbours, so writing depth would let a glyph's transparent
+     *  padding hide the ink of whichever glyph is drawn after it. */
     glEnable(GL_BLEND);
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
     glEnable(GL_DEPTH_TEST);
-    glDrawArrays(GL_TRIANGLES, 0, gui->buf_index / 6);
+    glDepthMask(GL_FALSE);
+    gui_end_stream_run(gui);
+    for (unsigned i=0; i < gui->run_count; ++i) {
+        const gui_run_t* r = &gui->runs[i];
+        if (!i || r->cached != gui->runs[i - 1].cached) {
+            glBindVertexArray(r->cached ? gui->cache_vao : gui->vao);
+        }
+        glDrawArrays(GL_TRIANGLES, r->first, r->count);
+    }
     glDisable(GL_BLEND);
+    glDepthMask(GL_TRUE);
+
+    if (gui->full) {
+        gui->overflow_frames++;
+        const int64_t now = platform_get_time_ns();
+        if (!gui->overflow_warn_ns ||
+            now - gui->overflow_warn_ns >= 1000000000LL)
+        {
+            log_warn("GUI vertex buffer is full; dropped vertices "
+                     "in %u frame(s)", gui->overflow_frames);
+            gui->overflow_frames = 0;
+            gui->overflow_warn_ns = now;
+        }
+    }
+
+    gui->fences[gui->segment] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    TRACE_END("gui_draw");
 }
@@ -1,31 +1,181 @@
 #include "camera.h"
-#include "compositor.h"
 #include "data.h"
 #include "gui.h"
 #include "instance.h"
+#include "jobs.h"
 #include "log.h"
 #include "map.h"
+#include "match.h"
 #include "mat.h"
 #include "object.h"
+#include "pick.h"
 #include "platform.h"
+#include "profiler.h"
+#include "record.h"
 #include "sm2.h"
+#include "states.h"
+#include "timing.h"
+#include "trie.h"
+#include "trace.h"
 #include "window.h"
 
-instance_t* instance_new(void) {
-    const float width = 500;
-    const float height = 500;
-    GLFWwindow* window = window_new("States Machine", width, height);
+/*  Startup tasks which don't need the OpenGL context.  These run as jobs
+ *  while the main thread builds the window and GL objects.  The first one
+ *  opens the spaced-repetition database, which needs its own job data. */
+typedef struct {
+    const char* path;
+    uint32_t profile;
+    sm2_t* sm2;
+} instance_sm2_job_t;
+
+static void instance_load_sm2(void* data) {
+    instance_sm2_job_t* job = (instance_sm2_job_t*)data;
+    job->sm2 = sm2_new(job->path);
+    sm2_set_profile(job->sm2, job->profile);
+}
+
+static void instance_load_font(void* out) {
+    *(gui_font_t**)out = gui_font_new();
+}
+
+static void instance_load_bounds(void* out) {
+    *(map_bounds_t*)out = map_bounds();
+}
+
+static void instance_load_match(void* out) {
+    *(match_t**)out = match_new(STATES_NAMES, STATES_COUNT);
+}
+
+static void instance_load_trie(void* out) {
+    *(trie_t**)out = trie_new(STATES_NAMES, STATES_COUNT);
+}
 
-    glfwShowWindow(window);
-    log_trace("Showed window");
+/*  Animates the camera to frame the given state (1-indexed) */
+static void instance_fly_to_state(instance_t* instance, unsigned state) {
+    map_bounds_t b = map_state_bounds(state);
+    camera_fly_to(instance->camera, b.center, b.scale / 2);
+}
 
+/*  Returns the database, with this instance's profile selected */
+static sm2_t* instance_sm2(instance_t* instance) {
+    sm2_set_profile(instance->sm2, instance->profile);
+    return instance->sm2;
+}
+
+/*  When replaying, swaps in the item from the recording.  When recording,
+ *  logs the item, since sm2 picks items at random. */
+static void instance_sync_item(instance_t* instance) {
+    record_event_t e;
+    if (instance->replay) {
+        if (record_peek(instance->replay, &e) && e.type == RECORD_ITEM) {
+            record_read(instance->replay, &e);
+            if (e.i[0] == ITEM_MODE_DONE) {
+                *instance->active = (sm2_item_t){ .mode = ITEM_MODE_DONE };
+            } else {
+                /*  Reload the item, so that grading it uses its own EF and
+                 *  repetition count rather than those of sm2's pick */
+                sm2_item_t* item = sm2_find(instance_sm2(instance),
+                                            e.i[1], e.i[0]);
+                if (item) {
+                    sm2_item_delete(instance->active);
+                    instance->active = item;
+                } else {
+                    log_warn("Replay diverged from recording (no item %i/%i)",
+                             e.i[0], e.i[1]);
+                }
+            }
+        } else {
+            log_warn("Replay diverged from recording (expected an item)");
+        }
+    }
+    if (instance->record) {
+        record_write(instance->record, (record_event_t){
+            .type = RECORD_ITEM,
+            .i = {instance->active->mode, instance->active->state}});
+    }
+}
+
+static void instance_join(instance_t* instance, jobs_counter_t* counter) {
+    TRACE_BEGIN("instance_join");
+    jobs_wait(instance->jobs, counter);
+    TRACE_END("instance_join");
+}
+
+instance_t* instance_new(const instance_config_t* config) {
+    TRACE_BEGIN("instance_new");
     OBJECT_ALLOC(instance);
+    instance->start_time = platform_get_time_ns();
+    instance->replay = config->replay;
+    instance->profile = config->profile;
+    instance->shared = config->share != NULL;
+    if (config->record_path) {
+        instance->record = record_new(config->record_path, true);
+        if (!instance->record) {
+            log_error_and_abort("Could not record to %s",
+                                config->record_path);
+        }
+    }
+
+    /*  When sharing with another instance, its database and font are
+     *  reused, so there's less to load */
+    instance_t* const share = config->share;
+    instance_sm2_job_t sm2 = { .path = config->db_path,
+                               .profile = config->profile };
+    gui_font_t* font = NULL;
+    map_bounds_t bounds;
+    jobs_counter_t sm2_done = {0};
+    jobs_counter_t font_done = {0};
+    jobs_counter_t bounds_done = {0};
+    jobs_counter_t match_done = {0};
+    jobs_counter_t trie_done = {0};
+    if (share) {
+        instance->jobs = share->jobs;
+        sm2.sm2 = share->sm2;
+    } else {
+        instance->jobs = jobs_new(0);
+        jobs_run(instance->jobs, instance_load_sm2, &sm2, &sm2_done);
+        jobs_run(instance->jobs, instance_load_font, &font, &font_done);
+    }
+    jobs_run(instance->jobs, instance_load_bounds, &bounds, &bounds_done);
+    jobs_run(instance->jobs, instance_load_match, &instance->match,
+             &match_done);
+    jobs_run(instance->jobs, instance_load_trie, &instance->trie, &trie_done);
 
-    /*  Next, build the OpenGL-dependent objects */
+    const float width = 500;
+    const float height = 500;
+    char title[64];
+    if (config->profile) {
+        snprintf(title, sizeof(title), "States Machine (profile %u)",
+                 config->profile);
+    } else {
+        snprintf(title, sizeof(title), "States Machine");
+    }
+    TRACE_BEGIN("window_new");
+    GLFWwindow* window = window_new(title, width, height,
+                                    share ? share->window : NULL);
+    /*  Set this now, since picking the first item uses the context */
+    instance->window = window;
+
+    if (!config->headless) {
+        glfwShowWindow(window);
+        log_trace("Showed window");
+    }
+    TRACE_END("window_new");
+
+    /*  Next, build the OpenGL-dependent objects, waiting on CPU-side
+     *  work from the worker threads as needed */
     instance->camera = camera_new(width, height);
-    instance->compositor = compositor_new(width, height);
-    instance->map = map_new(instance->camera);
-    instance->gui = gui_new();
+    instance->pick = pick_new(config->pick_scale > 0.0f
+                                  ? config->pick_scale : PICK_DEFAULT_SCALE,
+                              width, height);
+
+    instance_join(instance, &bounds_done);
+    instance->map = map_new(instance->camera, bounds,
+                            share ? share->map : NULL);
+
+    instance_join(instance, &font_done);
+    instance->gui = gui_new(font, share ? share->gui : NULL);
+    instance->profiler = profiler_new();
 
     /*  Find the longest state name and store it as input_size */
     memset(instance->input, 0, sizeof(instance->input));
@@ -39,7 +189,10 @@ instance_t* instance_new(void) {
     }
 
     /*  Load the next item to learn */
-    instance->sm2 = sm2_new();
+    instance_join(instance, &match_done);
+    instance_join(instance, &trie_done);
+    instance_join(instance, &sm2_done);
+    instance->sm2 = sm2.sm2;
     instance_next(instance);
 
     /*  This needs to happen after setting up the instance, because
@@ -53,52 +206,67 @@ instance_t* instance_new(void) {
     int w, h;
     glfwGetFramebufferSize(window, &w, &h);
     if (w != width || h != height) {
-        compositor_resize(instance->compositor, w, h);
+        pick_resize(instance->pick, w, h);
         camera_set_fb_size(instance->camera, w, h);
     }
 
+    TRACE_END("instance_new");
     return instance;
 }
 
 void instance_delete(instance_t* instance) {
+    /*  VAOs and framebuffers belong to this window's context */
+    glfwMakeContextCurrent(instance->window);
+
+    /*  Leave borrowed objects to the instance that owns them */
+    if (instance->shared) {
+        instance->jobs = NULL;
+        instance->sm2 = NULL;
+    }
+
+    /*  Finish background work first, since it may use other members */
+    OBJECT_DELETE_MEMBER(instance, jobs);
     OBJECT_DELETE_MEMBER(instance, camera);
-    OBJECT_DELETE_MEMBER(instance, compositor);
     OBJECT_DELETE_MEMBER(instance, gui);
     OBJECT_DELETE_MEMBER(instance, map);
+    OBJECT_DELETE_MEMBER(instance, match);
+    OBJECT_DELETE_MEMBER(instance, pick);
+    OBJECT_DELETE_MEMBER(instance, profiler);
+    OBJECT_DELETE_MEMBER(instance, record);
+    OBJECT_DELETE_MEMBER(instance, sm2);
+    OBJECT_DELETE_MEMBER(instance, trie);
     OBJECT_DELETE_MEMBER(instance, window);
     sm2_item_delete(instance->active);
     free(instance);
 }
 
 void instance_next(instance_t* instance) {
+    TRACE_BEGIN("instance_next");
     if (instance->active) {
         sm2_item_delete(instance->active);
         instance->active = NULL;
     }
-    instance->active = sm2_next(instance->sm2);
+    instance->active = sm2_next(instance_sm2(instance));
+    instance_sync_item(instance);
     instance->ui = UI_QUESTION;
 
     // Reset the text buffer
     memset(instance->input, 0, sizeof(instance->input));
     instance->input_index = 0;
     instance->wrong_state = 0;
+    trie_reset(instance->trie);
 
     if (instance->active->mode == ITEM_MODE_NAME) {
-        instance->active_state = 0;
-        for (unsigned i=0; i < STATES_COUNT; ++i) {
-            if (!strcmp(instance->active->state, STATES_NAMES[i])) {
-                instance->active_state = i + 1;
-            }
-        }
-        if (!instance->active_state) {
-            log_error_and_abort("Could not find state %s",
-                                instance->active->state);
-        }
+        instance->active_state = instance->active->state;
+        instance_fly_to_state(instance, instance->active_state);
     } else if (instance->active->mode == ITEM_MODE_POSITION) {
+        camera_fly_home(instance->camera);
         instance_update_active_state(instance);
     } else if (instance->active->mode == ITEM_MODE_DONE) {
         instance->active_state = 0;
+        camera_fly_home(instance->camera);
     }
+    TRACE_END("instance_next");
 }
 
 /******************************************************************************/
@@ -117,19 +285,54 @@ void instance_cb_window_size(instance_t* instance, int width, int height)
 
 void instance_cb_framebuffer_size(instance_t* instance, int width, int height)
 {
-    /*  Resize buffers for indirect rendering */
-    compositor_resize(instance->compositor, width, height);
+    /*  Resize the picking buffer */
+    pick_resize(instance->pick, width, height);
 
     /*  Record size in camera for mouse conversion */
     camera_set_fb_size(instance->camera, width, height);
 }
 
 void instance_update_active_state(instance_t* instance) {
-    int s = compositor_state_at(
-            instance->compositor, instance->mouse_x, instance->mouse_y);
-    if (s != instance->active_state) {
-        instance->active_state = s;
-        glfwPostEmptyEvent();
+    /*  Picking only runs while handling input, and the main loop draws
+     *  after every batch of events, so there's no need to post a redraw.
+     *  The IDs are only redrawn if the camera has moved since last time. */
+    TIMING_BEGIN(pick);
+    glfwMakeContextCurrent(instance->window);
+    if (pick_begin(instance->pick, camera_generation(instance->camera))) {
+        map_draw_ids(instance->map, instance->camera);
+        pick_end(instance->pick);
+    }
+    instance->active_state = pick_state_at(
+            instance->pick, instance->mouse_x, instance->mouse_y);
+    TIMING_END(pick);
+}
+
+void instance_queue_mouse_pos(instance_t* instance, float xpos, float ypos) {
+    instance->pending.has_pos = true;
+    instance->pending.x = xpos;
+    instance->pending.y = ypos;
+}
+
+void instance_queue_mouse_scroll(instance_t* instance,
+                                 float xoffset, float yoffset)
+{
+    instance->pending.scroll_x += xoffset;
+    instance->pending.scroll_y += yoffset;
+}
+
+void instance_flush_input(instance_t* instance) {
+    /*  Apply motion before scrolling, since zoom is centered on the mouse */
+    if (instance->pending.has_pos) {
+        instance->pending.has_pos = false;
+        instance_cb_mouse_pos(instance, instance->pending.x,
+                              instance->pending.y);
+    }
+    if (instance->pending.scroll_x || instance->pending.scroll_y) {
+        const float dx = instance->pending.scroll_x;
+        const float dy = instance->pending.scroll_y;
+        instance->pending.scroll_x = 0.0f;
+        instance->pending.scroll_y = 0.0f;
+        instance_cb_mouse_scroll(instance, dx, dy);
     }
 }
 
@@ -148,6 +351,7 @@ void instance_cb_mouse_click(instance_t* instance, int button,
                              int action, int mods)
 {
     (void)mods;
+    instance_flush_input(instance);
     if (action == GLFW_PRESS) {
         if (button == GLFW_MOUSE_BUTTON_1) {
             camera_begin_pan(instance->camera);
@@ -157,18 +361,12 @@ void instance_cb_mouse_click(instance_t* instance, int button,
                instance->active->mode == ITEM_MODE_POSITION &&
                instance->active_state)
     {
-        if (!strcmp(instance->active->state,
-                    STATES_NAMES[instance->active_state - 1]))
-        {
+        if (instance->active_state == (int)instance->active->state) {
             instance->ui = UI_ANSWER_RIGHT;
         } else {
             instance->wrong_state = instance->active_state;
-            for (unsigned i=0; i < STATES_COUNT; ++i) {
-                if (!strcmp(instance->active->state, STATES_NAMES[i])) {
-                    instance->active_state = i + 1;
-                    break;
-                }
-            }
+            instance->active_state = instance->active->state;
+            instance_fly_to_state(instance, instance->active_state);
             instance->ui = UI_ANSWER_WRONG;
         }
     }
@@ -184,27 +382,56 @@ void instance_cb_mouse_scroll(instance_t* instance,
 void instance_cb_key(instance_t* instance, int key, int scancode,
                      int action, int mods)
 {
+    instance_flush_input(instance);
+    if (key == GLFW_KEY_F3 && action == GLFW_PRESS) {
+        instance->show_profiler = !instance->show_profiler;
+        glfwPostEmptyEvent();
+    } else if (key == GLFW_KEY_F4 && action == GLFW_PRESS) {
+        char* p = platform_get_user_file("profile.csv");
+        if (p && profiler_dump_csv(instance->profiler, p)) {
+            log_info("Saved frame profile to %s", p);
+        }
+        free(p);
+    }
+
     if (instance->active->mode == ITEM_MODE_NAME) {
         if (key == GLFW_KEY_BACKSPACE &&
             (action == GLFW_PRESS || action == GLFW_REPEAT) &&
             instance->input_index)
         {
             instance->input[--instance->input_index] = 0;
+            trie_pop(instance->trie);
+        }
+        else if (key == GLFW_KEY_TAB && action == GLFW_PRESS &&
+                 instance->ui == UI_QUESTION && instance->input_index)
+        {
+            /*  Accept the autocompletion, one character at a time so
+             *  that the trie's cursor follows along */
+            const char* c = trie_completion(instance->trie);
+            while (*c && instance->input_index <= instance->input_size) {
+                instance->input[instance->input_index++] = *c;
+                trie_push(instance->trie, *c++);
+            }
         }
         else if (key == GLFW_KEY_ENTER && action == GLFW_RELEASE)
         {
-            if (!strncmp(instance->input, instance->active->state,
-                         instance->input_index - 1))
+            /*  Try for an exact match first, then accept answers with
+             *  a few typos.  If the answer is wrong, show whichever
+             *  state is closest to what was typed (if any). */
+            const char* name = states_name(instance->active->state);
+            unsigned typed = states_lookup(instance->input);
+            if (typed == instance->active->state ||
+                (!typed && match_distance(instance->input, name)
+                                <= match_tolerance(name)))
             {
                 instance->ui = UI_ANSWER_RIGHT;
             } else {
-                instance->wrong_state = 0;
-                for (unsigned i=0; i < STATES_COUNT; ++i) {
-                    if (!strncmp(instance->input, STATES_NAMES[i],
-                                 instance->input_index - 1)) {
-                        instance->wrong_state = i + 1;
-                    }
+                if (!typed) {
+                    typed = match_find(instance->match, instance->input,
+                                       match_tolerance(instance->input),
+                                       NULL);
                 }
+                instance->wrong_state = typed;
                 instance->ui = UI_ANSWER_WRONG;
             }
         }
@@ -219,6 +446,7 @@ void instance_cb_char(instance_t* instance, unsigned codepoint)
         codepoint >= ' ' && codepoint < '~')
     {
         instance->input[instance->input_index++] = codepoint;
+        trie_push(instance->trie, codepoint);
     } else {
         int q = -1;
         if (instance->ui == UI_ANSWER_RIGHT &&
@@ -232,13 +460,19 @@ void instance_cb_char(instance_t* instance, unsigned codepoint)
         }
 
         if (q >= 0) {
-            sm2_update(instance->sm2, instance->active, q);
+            sm2_update(instance_sm2(instance), instance->active, q);
             instance_next(instance);
         }
     }
 }
 
 bool instance_draw(instance_t* instance) {
+    TRACE_BEGIN("instance_draw");
+    TIMING_BEGIN(frame);
+    if (instance->record) {
+        record_write(instance->record, (record_event_t){.type = RECORD_FRAME});
+    }
+    instance_flush_input(instance);
     const bool needs_redraw = camera_check_anim(instance->camera);
 
     glfwMakeContextCurrent(instance->window);
@@ -250,18 +484,21 @@ bool instance_draw(instance_t* instance) {
     camera_check_viewport(instance->camera);
 #endif
 
-    glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
-    glClearDepth(1.0f);
+    profiler_frame_begin(instance->profiler);
 
-    // Draw to the compositor texture
-    compositor_bind(instance->compositor);
-    glClear(GL_COLOR_BUFFER_BIT);
-    map_draw(instance->map, instance->camera);
+    /*  The map is drawn straight to the window at full resolution,
+     *  over an ocean-colored background (0x303F9F) */
+    glClearColor(0x30 / 255.0f, 0x3F / 255.0f, 0x9F / 255.0f, 1.0f);
+    glClearDepth(1.0f);
 
+    profiler_begin(instance->profiler, PROFILER_PASS_MAP);
     glBindFramebuffer(GL_FRAMEBUFFER, 0);
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-    compositor_draw(instance->compositor, instance->active_state,
-                    instance->wrong_state);
+    map_draw(instance->map, instance->camera,
+             instance->active_state, instance->wrong_state);
+    profiler_end(instance->profiler, PROFILER_PASS_MAP);
+
+    profiler_begin(instance->profiler, PROFILER_PASS_GUI);
 
     char buf[64];
     switch (instance->active->mode) {
@@ -272,15 +509,26 @@ bool instance_draw(instance_t* instance) {
         case ITEM_MODE_NAME: {
             switch (instance->ui) {
                 case UI_QUESTION:
-                    snprintf(buf, sizeof(buf), "\x01This is \x02\x03%s\x04",
-                             instance->input);
+                    /*  Show the best completion as ghost text, followed
+                     *  by the number of candidates once typing starts */
+                    if (instance->input_index) {
+                        snprintf(buf, sizeof(buf),
+                                 "\x01This is \x02\x03%s\x07%s\x04\x01 (%u)",
+                                 instance->input,
+                                 trie_completion(instance->trie),
+                                 trie_count(instance->trie));
+                    } else {
+                        snprintf(buf, sizeof(buf),
+                                 "\x01This is \x02\x03%s\x07\x04",
+                                 instance->input);
+                    }
                     break;
                 case UI_ANSWER_RIGHT:
                     snprintf(buf, sizeof(buf), "Correct!");
                     break;
                 case UI_ANSWER_WRONG:
                     snprintf(buf, sizeof(buf), "\x01No, it is \x02%s",
-                             instance->active->state);
+                             states_name(instance->active->state));
                     break;
             }
             break;
@@ -289,14 +537,14 @@ bool instance_draw(instance_t* instance) {
             switch (instance->ui) {
                 case UI_QUESTION:
                     snprintf(buf, sizeof(buf), "\x01Where is \x02%s?",
-                             instance->active->state);
+                             states_name(instance->active->state));
                     break;
                 case UI_ANSWER_RIGHT:
                     snprintf(buf, sizeof(buf), "Correct!");
                     break;
                 case UI_ANSWER_WRONG:
                     snprintf(buf, sizeof(buf), "\x01No, that is \x02%s",
-                             STATES_NAMES[instance->wrong_state - 1]);
+                             states_name(instance->wrong_state));
                     break;
             }
             break;
@@ -322,8 +570,24 @@ bool instance_draw(instance_t* instance) {
                       aspect_ratio, 0.63f, 0);
         }
     }
+    if (instance->show_profiler) {
+        profiler_overlay(instance->profiler, instance->gui, aspect_ratio);
+    }
     gui_draw(instance->gui);
+    profiler_end(instance->profiler, PROFILER_PASS_GUI);
 
+    profiler_frame_end(instance->profiler);
     glfwSwapBuffers(instance->window);
+
+    if (instance->start_time) {
+        const int64_t dt_ns = platform_get_time_ns() - instance->start_time;
+        log_info("Time to first frame: %.1f ms", dt_ns / 1e6);
+        instance->start_time = 0;
+    }
+    TIMING_END(frame);
+    TRACE_END("instance_draw");
+
+    /*  Dump a summary of timers every ten seconds (at trace level) */
+    timing_report(10000000000LL);
     return needs_redraw;
 }
@@ -0,0 +1,380 @@
+#include "jobs.h"
+#include "log.h"
+#include "object.h"
+#include "platform.h"
+
+/*  Upper bound on the default worker count, since the workers live as
+ *  long as the job system and the callers only have a handful of jobs */
+#define JOBS_DEFAULT_WORKERS_MAX 4
+
+typedef struct job_ {
+    jobs_fn_t fn;
+    void* data;
+
+    /*  Decremented when the job finishes (may be NULL) */
+    jobs_counter_t* counter;
+
+    /*  The job is deferred until this reaches zero (may be NULL) */
+    jobs_counter_t* after;
+    struct job_* next;
+} job_t;
+
+/*  A growable ring buffer of jobs, protected by its own mutex */
+typedef struct {
+    platform_mutex_t* mutex;
+    job_t** data;
+    size_t capacity;
+    size_t head;
+    size_t size;
+} jobs_deque_t;
+
+typedef struct {
+    jobs_t* jobs;
+    unsigned index;
+    platform_thread_t* thread;
+} jobs_worker_t;
+
+struct jobs_ {
+    unsigned worker_count;
+    jobs_worker_t* workers;
+
+    /*  One deque per worker, plus a shared deque at the end which is
+     *  used when submitting jobs from any other thread */
+    jobs_deque_t* deques;
+
+    /*  Number of jobs in the deques.  This may briefly go negative, as
+     *  it's incremented after a job is pushed. */
+    int pending;
+
+    /*  Idle threads (both workers and jobs_wait) sleep on this condition
+     *  variable, which is signalled when jobs are pushed or counters reach
+     *  zero.  sleepers lets pushers skip the mutex if nobody is asleep. */
+    platform_mutex_t* mutex;
+    platform_cond_t* cond;
+    int sleepers;
+    bool quit;
+
+    /*  Jobs waiting on a counter, protected by mutex */
+    job_t* deferred;
+};
+
+/*  Identifies the worker running on this thread, if any */
+static __thread jobs_t* local_jobs = NULL;
+static __thread unsigned local_index = 0;
+
+////////////////////////////////////////////////////////////////////////////////
+
+static void jobs_deque_push_back(jobs_deque_t* d, job_t* job) {
+    platform_mutex_lock(d->mutex);
+    if (d->size == d->capacity) {
+        const size_t capacity = d->capacity ? d->capacity * 2 : 64;
+        job_t** data = malloc(capacity * sizeof(job_t*));
+        for (size_t i=0; i < d->size; ++i) {
+            data[i] = d->data[(d->head + i) % d->capacity];
+        }
+        free(d->data);
+        d->data = data;
+        d->capacity = capacity;
+        d->head = 0;
+    }
+    d->data[(d->head + d->size) % d->capacity] = job;
+    d->size++;
+    platform_mutex_unlock(d->mutex);
+}
+
+static job_t* jobs_deque_pop_back(jobs_deque_t* d) {
+    job_t* job = NULL;
+    platform_mutex_lock(d->mutex);
+    if (d->size) {
+        d->size--;
+        job = d->data[(d->head + d->size) % d->capacity];
+    }
+    platform_mutex_unlock(d->mutex);
+    return job;
+}
+
+static job_t* jobs_deque_pop_front(jobs_deque_t* d) {
+    job_t* job = NULL;
+    platform_mutex_lock(d->mutex);
+    if (d->size) {
+        job = d->data[d->head];
+        d->head = (d->head + 1) % d->capacity;
+        d->size--;
+    }
+    platform_mutex_unlock(d->mutex);
+    return job;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+/*  Returns the index of the calling thread's deque */
+static unsigned jobs_local_index(jobs_t* jobs) {
+    return (local_jobs == jobs) ? local_index : jobs->worker_count;
+}
+
+static void jobs_wake(jobs_t* jobs) {
+    platform_mutex_lock(jobs->mutex);
+    platform_cond_broadcast(jobs->cond);
+    platform_mutex_unlock(jobs->mutex);
+}
+
+static void jobs_push(jobs_t* jobs, job_t* job) {
+    jobs_deque_push_back(&jobs->deques[jobs_local_index(jobs)], job);
+
+    /*  Pairs with a sleeper incrementing sleepers then checking pending */
+    __atomic_add_fetch(&jobs->pending, 1, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&jobs->sleepers, __ATOMIC_SEQ_CST)) {
+        jobs_wake(jobs);
+    }
+}
+
+/*  Pops a job from this thread's deque, or steals one from another deque.
+ *  Returns NULL if there's nothing to run. */
+static job_t* jobs_take(jobs_t* jobs) {
+    const unsigned index = jobs_local_index(jobs);
+    job_t* job = jobs_deque_pop_back(&jobs->deques[index]);
+    for (unsigned i=1; !job && i <= jobs->worker_count; ++i) {
+        job = jobs_deque_pop_front(
+                &jobs->deques[(index + i) % (jobs->worker_count + 1)]);
+    }
+    if (job) {
+        __atomic_sub_fetch(&jobs->pending, 1, __ATOMIC_SEQ_CST);
+    }
+    return job;
+}
+
+/*  Queues any deferred jobs that were waiting on the given counter, and
+ *  wakes threads that may be waiting on it in jobs_wait */
+static void jobs_release(jobs_t* jobs, jobs_counter_t* counter) {
+    job_t* ready = NULL;
+    platform_mutex_lock(jobs->mutex);
+    job_t** j = &jobs->deferred;
+    while (*j) {
+        if ((*j)->after == counter) {
+            job_t* job = *j;
+            *j = job->next;
+            job->next = ready;
+            ready = job;
+        } else {
+            j = &(*j)->next;
+        }
+    }
+    platform_cond_broadcast(jobs->cond);
+    platform_mutex_unlock(jobs->mutex);
+
+    while (ready) {
+        job_t* next = ready->next;
+        jobs_push(jobs, ready);
+        ready = next;
+    }
+}
+
+static void jobs_execute(jobs_t* jobs, job_t* job) {
+    job->fn(job->data);
+    if (job->counter &&
+        !__atomic_sub_fetch(&job->counter->count, 1, __ATOMIC_ACQ_REL))
+    {
+        jobs_release(jobs, job->counter);
+    }
+    free(job);
+}
+
+/*  Sleeps until there may be a job to run, the counter (if given) reaches
+ *  zero, or the system is shutting down */
+static void jobs_sleep(jobs_t* jobs, jobs_counter_t* counter) {
+    platform_mutex_lock(jobs->mutex);
+    __atomic_add_fetch(&jobs->sleepers, 1, __ATOMIC_SEQ_CST);
+    while (!jobs->quit &&
+           __atomic_load_n(&jobs->pending, __ATOMIC_SEQ_CST) <= 0 &&
+           (!counter || __atomic_load_n(&counter->count, __ATOMIC_ACQUIRE)))
+    {
+        platform_cond_wait(jobs->cond, jobs->mutex);
+    }
+    __atomic_sub_fetch(&jobs->sleepers, 1, __ATOMIC_SEQ_CST);
+    platform_mutex_unlock(jobs->mutex);
+}
+
+static void* jobs_worker_run(void* data) {
+    jobs_worker_t* worker = data;
+    jobs_t* jobs = worker->jobs;
+    local_jobs = jobs;
+    local_index = worker->index;
+
+    while (true) {
+        job_t* job = jobs_take(jobs);
+        if (job) {
+            jobs_execute(jobs, job);
+            continue;
+        }
+
+        platform_mutex_lock(jobs->mutex);
+        const bool done = jobs->quit &&
+            __atomic_load_n(&jobs->pending, __ATOMIC_SEQ_CST) <= 0;
+        platform_mutex_unlock(jobs->mutex);
+        if (done) {
+            break;
+        }
+        jobs_sleep(jobs, NULL);
+    }
+    return NULL;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+jobs_t* jobs_new(unsigned workers) {
+    OBJECT_ALLOC(jobs);
+    if (!workers) {
+        workers = platform_cpu_count() - 1;
+        if (!workers) {
+            workers = 1;
+        } else if (workers > JOBS_DEFAULT_WORKERS_MAX) {
+            workers = JOBS_DEFAULT_WORKERS_MAX;
+        }
+    }
+    jobs->worker_count = workers;
+    jobs->mutex = platform_mutex_new();
+    jobs->cond = platform_cond_new();
+
+    jobs->deques = calloc(workers + 1, sizeof(jobs_deque_t));
+    for (unsigned i=0; i <= workers; ++i) {
+        jobs->deques[i].mutex = platform_mutex_new();
+    }
+
+    jobs->workers = calloc(workers, sizeof(jobs_worker_t));
+    for (unsigned i=0; i < workers; ++i) {
+        jobs->workers[i].jobs = jobs;
+        jobs->workers[i].index = i;
+        /*  This aborts if the thread can't be created */
+        jobs->workers[i].thread = platform_thread_new(
+                jobs_worker_run, &jobs->workers[i]);
+    }
+    log_trace("Started %u job workers", workers);
+    return jobs;
+}
+
+void jobs_delete(jobs_t* jobs) {
+    platform_mutex_lock(jobs->mutex);
+    jobs->quit = true;
+    platform_cond_broadcast(jobs->cond);
+    platform_mutex_unlock(jobs->mutex);
+
+    for (unsigned i=0; i < jobs->worker_count; ++i) {
+        if (platform_thread_join(jobs->workers[i].thread)) {
+            log_error_and_abort("Failed to join job worker");
+        }
+        platform_thread_delete(jobs->workers[i].thread);
+    }
+    free(jobs->workers);
+
+    /*  Jobs submitted from other threads after the workers stopped */
+    job_t* job;
+    while ((job = jobs_take(jobs))) {
+        jobs_execute(jobs, job);
+    }
+    for (unsigned i=0; i <= jobs->worker_count; ++i) {
+        platform_mutex_delete(jobs->deques[i].mutex);
+        free(jobs->deques[i].data);
+    }
+    free(jobs->deques);
+
+    if (jobs->deferred) {
+        log_warn("Deleting job system with unfinished dependencies");
+        while (jobs->deferred) {
+            job = jobs->deferred;
+            jobs->deferred = job->next;
+            free(job);
+        }
+    }
+    platform_mutex_delete(jobs->mutex);
+    platform_cond_delete(jobs->cond);
+    free(jobs);
+}
+
+void jobs_run_after(jobs_t* jobs, jobs_counter_t* after,
+                    jobs_fn_t fn, void* data, jobs_counter_t* counter)
+{
+    OBJECT_ALLOC(job);
+    job->fn = fn;
+    job->data = data;
+    job->counter = counter;
+    job->after = after;
+    if (counter) {
+        __atomic_add_fetch(&counter->count, 1, __ATOMIC_ACQ_REL);
+    }
+
+    /*  This check is done under the mutex, which jobs_release also takes
+     *  after the counter reaches zero, so the job can't be missed */
+    if (after) {
+        platform_mutex_lock(jobs->mutex);
+        const bool deferred = __atomic_load_n(&after->count, __ATOMIC_ACQUIRE);
+        if (deferred) {
+            job->next = jobs->deferred;
+            jobs->deferred = job;
+        }
+        platform_mutex_unlock(jobs->mutex);
+        if (deferred) {
+            return;
+        }
+    }
+    jobs_push(jobs, job);
+}
+
+void jobs_run(jobs_t* jobs, jobs_fn_t fn, void* data,
+              jobs_counter_t* counter)
+{
+    jobs_run_after(jobs, NULL, fn, data, counter);
+}
+
+void jobs_wait(jobs_t* jobs, jobs_counter_t* counter) {
+    while (__atomic_load_n(&counter->count, __ATOMIC_ACQUIRE)) {
+        job_t* job = jobs_take(jobs);
+        if (job) {
+            jobs_execute(jobs, job);
+        } else {
+            jobs_sleep(jobs, counter);
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+typedef struct {
+    jobs_range_fn_t fn;
+    void* data;
+    size_t begin;
+    size_t end;
+} jobs_range_t;
+
+static void jobs_range_run(void* data) {
+    jobs_range_t* r = data;
+    r->fn(r->data, r->begin, r->end);
+}
+
+void jobs_parallel_for(jobs_t* jobs, size_t n, size_t grain,
+                       jobs_range_fn_t fn, void* data)
+{
+    if (!grain) {
+        grain = 1;
+    }
+    const size_t chunks = (n + grain - 1) / grain;
+    if (chunks <= 1) {
+        if (n) {
+            fn(data, 0, n);
+        }
+        return;
+    }
+
+    jobs_range_t* ranges = calloc(chunks, sizeof(jobs_range_t));
+    jobs_counter_t counter = {0};
+    for (size_t i=0; i < chunks; ++i) {
+        ranges[i] = (jobs_range_t){
+            .fn = fn,
+            .data = data,
+            .begin = i * grain,
+            .end = (i + 1) * grain < n ? (i + 1) * grain : n,
+        };
+        jobs_run(jobs, jobs_range_run, &ranges[i], &counter);
+    }
+    jobs_wait(jobs, &counter);
+    free(ranges);
+}
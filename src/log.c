@@ -2,6 +2,67 @@
 #include "log.h"
 #include "log_align.h"
 
+/*  Messages are formatted on the calling thread into a bounded ring of
+ *  fixed-size records, then written out by a background thread.  The ring
+ *  is a lock-free queue in the style of Dmitry Vyukov's bounded MPMC queue:
+ *  each cell's sequence number says whether it is ready to be written by a
+ *  producer (seq == pos) or read by the consumer (seq == pos + 1). */
+#define LOG_RING_SIZE 256
+#define LOG_RECORD_TEXT 232
+
+/*  Binary log records, which are decoded by tools/log_decode.py */
+#define LOG_BINARY_MAGIC "smlog\0\0\1"
+#define LOG_BINARY_SITE 1
+#define LOG_BINARY_MESSAGE 2
+
+typedef struct {
+    log_site_t* site;
+    int64_t time;
+
+    /*  For binary records, text is packed arguments rather than a string */
+    bool binary;
+    uint16_t size;
+    char text[LOG_RECORD_TEXT];
+} log_record_t;
+
+typedef struct {
+    size_t seq;
+    log_record_t record;
+} log_cell_t;
+
+static log_cell_t ring[LOG_RING_SIZE];
+static size_t enqueue_pos = 0;
+static size_t dequeue_pos = 0;
+
+/*  Only one thread writes to the terminal at a time, which is normally
+ *  the background thread.  Synchronous writes take this mutex too, so
+ *  that they're ordered after any queued messages. */
+static platform_mutex_t* drain_mutex = NULL;
+
+/*  The background thread sets this flag before waiting on the condition
+ *  variable, so producers only need to signal it when it's asleep. */
+static platform_mutex_t* wake_mutex = NULL;
+static platform_cond_t* wake_cond = NULL;
+static int sleeping = 0;
+
+/*  0 is uninitialized, 1 is initializing, 2 is ready */
+static int init_state = 0;
+static __thread bool init_thread = false;
+
+/*  Background thread, which is stopped and joined at exit.  Once
+ *  stopping is set, every message is written synchronously. */
+static platform_thread_t* drain_thread = NULL;
+static bool stopping = false;
+
+static int64_t start_usec = 0;
+
+/*  Binary log file, or NULL if messages are written to the terminal */
+static FILE* binary = NULL;
+
+/*  List of call sites that have been used, protected by drain_mutex */
+static log_site_t* sites = NULL;
+static uint32_t site_count = 0;
+
 platform_terminal_color_t log_message_color(log_type_t t) {
     switch (t) {
         case LOG_TRACE: return TERM_COLOR_BLUE;
@@ -12,53 +73,437 @@ platform_terminal_color_t log_message_color(log_type_t t) {
     }
 }
 
-static struct platform_mutex_* mut = NULL;
+static void log_write(const log_site_t* site, int64_t time,
+                      const char* text)
+{
+    const uint64_t dt_usec = time - start_usec;
+
+    FILE* out = (site->type == LOG_ERROR) ? stderr : stdout;
+
+    platform_set_terminal_color(out, log_message_color(site->type));
+    fprintf(out, "[sm]");
+
+    platform_set_terminal_color(out, TERM_COLOR_WHITE);
+    fprintf(out, " (%u.%06u) ", (uint32_t)(dt_usec / 1000000),
+                                (uint32_t)(dt_usec % 1000000));
+
+    platform_clear_terminal_color(out);
+    fprintf(out, "%s:%i %*s| %s\n", site->filename, site->line,
+            site->pad, "", text);
+}
+
+static void log_write_u16(uint16_t v) {
+    fwrite(&v, sizeof(v), 1, binary);
+}
+
+static void log_write_u32(uint32_t v) {
+    fwrite(&v, sizeof(v), 1, binary);
+}
+
+static void log_write_site(const log_site_t* site) {
+    const size_t file_len = strlen(site->filename);
+    const size_t fmt_len = strlen(site->fmt);
+    fputc(LOG_BINARY_SITE, binary);
+    log_write_u32(site->id);
+    fputc(site->type, binary);
+    log_write_u32(site->line);
+    log_write_u16(file_len);
+    fwrite(site->filename, 1, file_len, binary);
+    log_write_u16(fmt_len);
+    fwrite(site->fmt, 1, fmt_len, binary);
+}
+
+static void log_write_binary(const log_record_t* r) {
+    fputc(LOG_BINARY_MESSAGE, binary);
+    const int64_t dt_usec = r->time - start_usec;
+    log_write_u32(r->site->id);
+    fwrite(&dt_usec, sizeof(dt_usec), 1, binary);
+    log_write_u16(r->size);
+    fwrite(r->text, 1, r->size, binary);
+}
+
+/*  Writes every queued record.  Must be called with drain_mutex held. */
+static void log_drain(void) {
+    size_t pos = __atomic_load_n(&dequeue_pos, __ATOMIC_RELAXED);
+    while (pos != __atomic_load_n(&enqueue_pos, __ATOMIC_ACQUIRE)) {
+        log_cell_t* cell = &ring[pos % LOG_RING_SIZE];
+
+        /*  Spin if a producer has claimed this cell but hasn't finished
+         *  filling it in */
+        while (__atomic_load_n(&cell->seq, __ATOMIC_ACQUIRE) != pos + 1);
+
+        const log_record_t* r = &cell->record;
+        if (r->binary) {
+            log_write_binary(r);
+        } else {
+            log_write(r->site, r->time, r->text);
+        }
+
+        __atomic_store_n(&cell->seq, pos + LOG_RING_SIZE, __ATOMIC_RELEASE);
+        __atomic_store_n(&dequeue_pos, ++pos, __ATOMIC_RELAXED);
+    }
+    fflush(stdout);
+    fflush(stderr);
+    if (binary) {
+        fflush(binary);
+    }
+}
+
+/*  Claims a cell and copies the record into it.
+ *  Returns false if the ring is full. */
+static bool log_enqueue(const log_record_t* r) {
+    size_t pos = __atomic_load_n(&enqueue_pos, __ATOMIC_RELAXED);
+    log_cell_t* cell;
+    while (true) {
+        cell = &ring[pos % LOG_RING_SIZE];
+        const size_t seq = __atomic_load_n(&cell->seq, __ATOMIC_ACQUIRE);
+        const intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+        if (diff == 0) {
+            if (__atomic_compare_exchange_n(&enqueue_pos, &pos, pos + 1,
+                    true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            {
+                break;
+            }
+        } else if (diff < 0) {
+            return false;
+        } else {
+            pos = __atomic_load_n(&enqueue_pos, __ATOMIC_RELAXED);
+        }
+    }
+    cell->record = *r;
+    __atomic_store_n(&cell->seq, pos + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+static void* log_run(void* data) {
+    (void)data;
+    bool stop = false;
+    while (!stop) {
+        platform_mutex_lock(wake_mutex);
+        __atomic_store_n(&sleeping, 1, __ATOMIC_SEQ_CST);
+        while (__atomic_load_n(&dequeue_pos, __ATOMIC_SEQ_CST) ==
+               __atomic_load_n(&enqueue_pos, __ATOMIC_SEQ_CST) &&
+               !__atomic_load_n(&stopping, __ATOMIC_SEQ_CST))
+        {
+            platform_cond_wait(wake_cond, wake_mutex);
+        }
+        __atomic_store_n(&sleeping, 0, __ATOMIC_SEQ_CST);
+        stop = __atomic_load_n(&stopping, __ATOMIC_SEQ_CST);
+        platform_mutex_unlock(wake_mutex);
+
+        /*  When stopping, this writes everything queued before then */
+        platform_mutex_lock(drain_mutex);
+        log_drain();
+        platform_mutex_unlock(drain_mutex);
+    }
+    return NULL;
+}
+
+/*  Stops and joins the background thread, then writes any messages that
+ *  were queued while it was finishing up.  Registered with atexit. */
+static void log_stop(void) {
+    platform_mutex_lock(wake_mutex);
+    __atomic_store_n(&stopping, true, __ATOMIC_SEQ_CST);
+    platform_cond_broadcast(wake_cond);
+    platform_mutex_unlock(wake_mutex);
+
+    platform_thread_join(drain_thread);
+    platform_thread_delete(drain_thread);
+    drain_thread = NULL;
+    log_flush();
+}
+
+static void log_init(void) {
+    int expected = 0;
+    if (__atomic_load_n(&init_state, __ATOMIC_ACQUIRE) == 2) {
+        return;
+    } else if (!__atomic_compare_exchange_n(&init_state, &expected, 1,
+                    false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+    {
+        /*  Another thread is setting things up */
+        while (__atomic_load_n(&init_state, __ATOMIC_ACQUIRE) != 2);
+        return;
+    }
+
+    init_thread = true;
+    start_usec = platform_get_time();
+    for (unsigned i=0; i < LOG_RING_SIZE; ++i) {
+        ring[i].seq = i;
+    }
+    drain_mutex = platform_mutex_new();
+    wake_mutex = platform_mutex_new();
+    wake_cond = platform_cond_new();
+    __atomic_store_n(&init_state, 2, __ATOMIC_RELEASE);
+    init_thread = false;
+
+    /*  The thread is started after marking the logger as ready, so that
+     *  errors while starting it (which abort) are written synchronously */
+    drain_thread = platform_thread_new(log_run, NULL);
+    atexit(log_stop);
+}
 
-void log_lock() {
-    if (mut == NULL) {
-        mut = platform_mutex_new();
+void log_flush(void) {
+    if (__atomic_load_n(&init_state, __ATOMIC_ACQUIRE) == 2) {
+        platform_mutex_lock(drain_mutex);
+        log_drain();
+        platform_mutex_unlock(drain_mutex);
     }
-    platform_mutex_lock(mut);
 }
-void log_unlock() {
-    platform_mutex_unlock(mut);
+
+/*  Fills in the cached parts of a call site on first use, and writes its
+ *  definition to the binary log (so that messages can refer to its ID). */
+static void log_site_init(log_site_t* site, const char* fmt) {
+    platform_mutex_lock(drain_mutex);
+    if (!__atomic_load_n(&site->id, __ATOMIC_RELAXED)) {
+        site->filename = platform_filename(site->file);
+        site->fmt = fmt;
+
+        /*  Figure out how much to pad the filename + line number */
+        int pad = 0;
+        for (int i=site->line; i; i /= 10, pad++);
+        pad += strlen(site->filename);
+        pad = LOG_ALIGN - pad - 6;
+        assert(pad >= 0);
+        site->pad = pad;
+
+        site->next = sites;
+        sites = site;
+        __atomic_store_n(&site->id, ++site_count, __ATOMIC_RELEASE);
+        if (binary) {
+            log_write_site(site);
+        }
+    }
+    platform_mutex_unlock(drain_mutex);
 }
 
-FILE* log_preamble(log_type_t t, const char* file, int line)
+/*  Copies a value into the packed argument buffer, with a one-byte tag */
+#define LOG_PACK(tag, T, value) do {                \
+    const T v_ = (value);                           \
+    if (n + 1 + sizeof(v_) > size) {                \
+        return n;                                   \
+    }                                               \
+    buf[n++] = tag;                                 \
+    memcpy(&buf[n], &v_, sizeof(v_));               \
+    n += sizeof(v_);                                \
+} while (0)
+
+/*  Walks the format string, packing each argument as a tagged value:
+ *  'i' (int64_t), 'u' (uint64_t), 'f' (double), or 's' (uint16_t length,
+ *  then the string's bytes).  Returns the number of bytes used; arguments
+ *  that don't fit are dropped, and long strings are truncated. */
+static uint16_t log_pack(char* buf, uint16_t size,
+                         const char* fmt, va_list args)
 {
-    static int64_t start_usec = -1;
+    uint16_t n = 0;
+    for (const char* c=fmt; *c; ++c) {
+        if (*c != '%' || *++c == '%') {
+            continue;
+        }
+        while (*c && strchr("-+ #0", *c)) {
+            c++;
+        }
+        if (*c == '*') {
+            LOG_PACK('i', int64_t, va_arg(args, int));
+            c++;
+        }
+        while (isdigit((unsigned char)*c)) {
+            c++;
+        }
+        if (*c == '.' && *++c == '*') {
+            LOG_PACK('i', int64_t, va_arg(args, int));
+            c++;
+        }
+        while (isdigit((unsigned char)*c)) {
+            c++;
+        }
+
+        /*  Length modifiers; 'h' and 'hh' are promoted to int anyways */
+        char len = 0;
+        while (*c && strchr("hljztL", *c)) {
+            len = (*c == 'l' && len == 'l') ? 'q' : *c;
+            c++;
+        }
 
-    if (start_usec == -1) {
-        start_usec = platform_get_time();
+        switch (*c) {
+            case 'd': case 'i': case 'c':
+                switch (len) {
+                    case 'l': LOG_PACK('i', int64_t, va_arg(args, long));
+                              break;
+                    case 'q': LOG_PACK('i', int64_t, va_arg(args, long long));
+                              break;
+                    case 'j': LOG_PACK('i', int64_t, va_arg(args, intmax_t));
+                              break;
+                    case 'z': LOG_PACK('i', int64_t, va_arg(args, size_t));
+                              break;
+                    case 't': LOG_PACK('i', int64_t, va_arg(args, ptrdiff_t));
+                              break;
+                    default:  LOG_PACK('i', int64_t, va_arg(args, int));
+                              break;
+                }
+                break;
+            case 'u': case 'o': case 'x': case 'X':
+                switch (len) {
+                    case 'l': LOG_PACK('u', uint64_t,
+                                       va_arg(args, unsigned long));
+                              break;
+                    case 'q': LOG_PACK('u', uint64_t,
+                                       va_arg(args, unsigned long long));
+                              break;
+                    case 'j': LOG_PACK('u', uint64_t, va_arg(args, uintmax_t));
+                              break;
+                    case 'z': LOG_PACK('u', uint64_t, va_arg(args, size_t));
+                              break;
+                    case 't': LOG_PACK('u', uint64_t, va_arg(args, ptrdiff_t));
+                              break;
+                    default:  LOG_PACK('u', uint64_t, va_arg(args, unsigned));
+                              break;
+                }
+                break;
+            case 'e': case 'E': case 'f': case 'F':
+            case 'g': case 'G': case 'a': case 'A':
+                if (len == 'L') {
+                    LOG_PACK('f', double, va_arg(args, long double));
+                } else {
+                    LOG_PACK('f', double, va_arg(args, double));
+                }
+                break;
+            case 'p':
+                LOG_PACK('u', uint64_t, (uintptr_t)va_arg(args, void*));
+                break;
+            case 's': {
+                const char* s = va_arg(args, const char*);
+                size_t s_len = s ? strlen(s) : 0;
+                if (n + 3 > size) {
+                    return n;
+                } else if (n + 3 + s_len > size) {
+                    s_len = size - n - 3;
+                }
+                const uint16_t s_len16 = s_len;
+                buf[n++] = 's';
+                memcpy(&buf[n], &s_len16, sizeof(s_len16));
+                n += sizeof(s_len16);
+                memcpy(&buf[n], s, s_len);
+                n += s_len;
+                break;
+            }
+            case 'n':
+                va_arg(args, void*);
+                break;
+            case '\0':
+                return n;
+            default:
+                break;
+        }
     }
+    return n;
+}
 
-    const uint64_t dt_usec = platform_get_time() - start_usec;
+bool log_binary_open(const char* filename) {
+    log_init();
+    FILE* f = fopen(filename, "wb");
+    if (!f) {
+        return false;
+    }
 
-    FILE* out = (t == LOG_ERROR) ? stderr : stdout;
+    platform_mutex_lock(drain_mutex);
+    log_drain();
+    binary = f;
+    fwrite(LOG_BINARY_MAGIC, 1, 8, binary);
+    fwrite(&start_usec, sizeof(start_usec), 1, binary);
+    for (const log_site_t* site=sites; site; site = site->next) {
+        log_write_site(site);
+    }
+    platform_mutex_unlock(drain_mutex);
+    return true;
+}
 
-    const char* filename = platform_filename(file);
+void log_message(log_site_t* site, const char* fmt, ...) {
+    /*  If setting up the logger fails, then report it without locking */
+    if (init_thread) {
+        va_list args;
+        va_start(args, fmt);
+        fprintf(stderr, "%s:%i | ", platform_filename(site->file),
+                site->line);
+        vfprintf(stderr, fmt, args);
+        fprintf(stderr, "\n");
+        va_end(args);
+        return;
+    }
+    log_init();
+    if (!__atomic_load_n(&site->id, __ATOMIC_ACQUIRE)) {
+        log_site_init(site, fmt);
+    }
 
-    /*  Figure out how much to pad the filename + line number */
-    int pad = 0;
-    for (int i=line; i; i /= 10, pad++);
-    pad += strlen(filename);
-    pad = LOG_ALIGN - pad - 6;
-    assert(pad >= 0);
+    log_record_t r = {
+        .site = site,
+        .time = platform_get_time(),
+        .binary = __atomic_load_n(&binary, __ATOMIC_ACQUIRE) != NULL,
+    };
+    int len = 0;
+    va_list args;
+    va_start(args, fmt);
+    if (r.binary) {
+        r.size = log_pack(r.text, sizeof(r.text), fmt, args);
+    } else {
+        len = vsnprintf(r.text, sizeof(r.text), fmt, args);
+    }
+    va_end(args);
 
-    platform_set_terminal_color(out, log_message_color(t));
-    fprintf(out, "[sm]");
+    const bool error = (site->type == LOG_ERROR);
+    if (!error && (r.binary || len < LOG_RECORD_TEXT) &&
+        !__atomic_load_n(&stopping, __ATOMIC_ACQUIRE))
+    {
+        /*  If the ring is full, then drain it on this thread */
+        while (!log_enqueue(&r)) {
+            log_flush();
+        }
 
-    platform_set_terminal_color(out, TERM_COLOR_WHITE);
-    fprintf(out, " (%u.%06u) ", (uint32_t)(dt_usec / 1000000),
-                                (uint32_t)(dt_usec % 1000000));
+        /*  Pairs with the background thread setting sleeping then
+         *  checking the queue, so either it sees this record or we see
+         *  that it's asleep */
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        if (__atomic_load_n(&sleeping, __ATOMIC_RELAXED)) {
+            platform_mutex_lock(wake_mutex);
+            platform_cond_broadcast(wake_cond);
+            platform_mutex_unlock(wake_mutex);
+        }
+        return;
+    }
 
-    platform_clear_terminal_color(out);
-    fprintf(out, "%s:%i ", filename, line);
+    /*  Otherwise, write the message synchronously.  Errors are always
+     *  printed to the terminal, so they're formatted even in binary mode,
+     *  and long messages (e.g. shader errors) are formatted again into a
+     *  buffer that's large enough. */
+    char* text = NULL;
+    if (error || !r.binary) {
+        if (r.binary || len >= LOG_RECORD_TEXT) {
+            va_start(args, fmt);
+            len = vsnprintf(NULL, 0, fmt, args);
+            va_end(args);
 
-    while (pad--) {
-        fputc(' ', out);
+            text = malloc(len + 1);
+            va_start(args, fmt);
+            vsnprintf(text, len + 1, fmt, args);
+            va_end(args);
+        } else {
+            text = r.text;
+        }
     }
 
-    fprintf(out, "| ");
-    return out;
+    platform_mutex_lock(drain_mutex);
+    log_drain();
+    if (r.binary) {
+        log_write_binary(&r);
+        fflush(binary);
+    }
+    if (text) {
+        log_write(site, r.time, text);
+        fflush(stdout);
+        fflush(stderr);
+    }
+    platform_mutex_unlock(drain_mutex);
+
+    if (text != r.text) {
+        free(text);
+    }
 }
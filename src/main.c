@@ -1,31 +1,136 @@
 #include "instance.h"
 #include "log.h"
 #include "platform.h"
+#include "replay.h"
+#include "trace.h"
 #include "window.h"
 
+/*  Every open window is drawn each time through the main loop, so only
+ *  the first one waits for vsync (otherwise, each would wait in turn) */
+static void main_set_vsync(instance_t** instances, const bool* closed,
+                           unsigned count)
+{
+    bool first = true;
+    for (unsigned i=0; i < count; ++i) {
+        if (!closed[i]) {
+            glfwMakeContextCurrent(instances[i]->window);
+            glfwSwapInterval(first);
+            first = false;
+        }
+    }
+}
+
 int main(int argc, char** argv) {
+    instance_config_t config = {0};
+    const char* replay = NULL;
+    unsigned count = 1;
+    for (int i=1; i < argc; ++i) {
+        if (!strcmp(argv[i], "--binary-log") && i + 1 < argc) {
+            const char* filename = argv[++i];
+            log_info("Writing binary log to %s", filename);
+            if (!log_binary_open(filename)) {
+                log_error_and_abort("Could not open %s", filename);
+            }
+        } else if (!strcmp(argv[i], "--record") && i + 1 < argc) {
+            config.record_path = argv[++i];
+            log_info("Recording input to %s", config.record_path);
+        } else if (!strcmp(argv[i], "--replay") && i + 1 < argc) {
+            replay = argv[++i];
+        } else if (!strcmp(argv[i], "--profile") && i + 1 < argc) {
+            config.profile = strtoul(argv[++i], NULL, 10);
+            log_info("Using profile %u", config.profile);
+        } else if (!strcmp(argv[i], "--windows") && i + 1 < argc) {
+            count = atoi(argv[++i]);
+            if (count < 1 || count > 16) {
+                log_error_and_abort("--windows must be between 1 and 16");
+            }
+        } else if (!strcmp(argv[i], "--pick-scale") && i + 1 < argc) {
+            config.pick_scale = atof(argv[++i]);
+            if (!(config.pick_scale > 0.0f && config.pick_scale <= 1.0f)) {
+                log_error_and_abort("--pick-scale must be in (0, 1]");
+            }
+        } else {
+            log_error_and_abort("Unknown argument '%s'", argv[i]);
+        }
+    }
     log_info("Startup!");
-    if (argc > 1) {
-        log_error_and_abort("Too many arguments (expected 0)");
+
+    if (replay) {
+        if (!replay_run(replay)) {
+            log_error_and_abort("Could not replay %s", replay);
+        }
+        return 0;
     }
 
-    instance_t* instance = instance_new();
+    char* db_path = platform_get_user_file("sm.sqlite");
+    config.db_path = db_path;
+    if (db_path == NULL) {
+        log_error_and_abort("Could not open sm.sqlite");
+    }
+    if (config.record_path && count > 1) {
+        log_error_and_abort("--record only supports one window");
+    }
+
+    /*  Each window quizzes its own profile, counting up from --profile.
+     *  The first window owns the GL objects, jobs, and database, which
+     *  the others borrow. */
+    instance_t** instances = calloc(count, sizeof(instance_t*));
+    bool* closed = calloc(count, sizeof(bool));
+    const uint32_t profile = config.profile;
+    for (unsigned i=0; i < count; ++i) {
+        config.profile = profile + i;
+        config.share = i ? instances[0] : NULL;
+        instances[i] = instance_new(&config);
+    }
 
     /* Platform-specific initialization */
     platform_init(argc, argv);
 
     /*  Avoid tearing */
-    glfwSwapInterval(1);
+    main_set_vsync(instances, closed, count);
 
-    while (instance) {
-        if (glfwWindowShouldClose(instance->window)) {
-            instance_delete(instance);
-            instance = NULL;
-        } else if (instance_draw(instance)) {
+    /*  Closed windows are hidden rather than deleted, since the others
+     *  may be borrowing their objects */
+    unsigned open = count;
+    while (open) {
+        bool redraw = false;
+        for (unsigned i=0; i < count; ++i) {
+            if (closed[i]) {
+                continue;
+            } else if (glfwWindowShouldClose(instances[i]->window)) {
+                glfwHideWindow(instances[i]->window);
+                closed[i] = true;
+                if (--open) {
+                    main_set_vsync(instances, closed, count);
+                }
+            } else if (instance_draw(instances[i])) {
+                redraw = true;
+            }
+        }
+        if (redraw) {
             glfwPostEmptyEvent();
         }
-        glfwWaitEvents();
+        if (open) {
+            glfwWaitEvents();
+        }
+    }
+
+    /*  Delete in reverse order, so that owners outlive borrowers */
+    for (unsigned i=count; i--;) {
+        instance_delete(instances[i]);
+    }
+    free(instances);
+    free(closed);
+
+    free(db_path);
+
+#ifdef TRACE_ENABLED
+    char* trace_path = platform_get_user_file("trace.json");
+    if (trace_path) {
+        TRACE_FLUSH(trace_path);
+        free(trace_path);
     }
+#endif
 
     return 0;
 }
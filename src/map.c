@@ -5,23 +5,23 @@
 #include "mat.h"
 #include "object.h"
 #include "shader.h"
+#include "trace.h"
 
 static const GLchar* MAP_VS_SRC = GLSL(330,
 layout(location=0) in vec3 pos;
 
-uniform mat4 proj;
-uniform mat4 view;
-uniform mat4 model;
+uniform mat4 mvp;
 
 out float state_color;
 
 void main() {
     vec4 p = vec4(pos.xy, 0.0f, 1.0f);
-    gl_Position = proj * view * model * p;
+    gl_Position = mvp * p;
     state_color = pos.z;
 }
 );
 
+/*  Writes state IDs, for picking (see pick.h) */
 static const GLchar* MAP_FS_SRC = GLSL(330,
 in float state_color;
 layout(location=0) out int out_color;
@@ -31,72 +31,217 @@ void main() {
 }
 );
 
+/*  Writes the visible image, which is drawn straight to the window at
+ *  full resolution.  Borders are drawn as lines with border = true. */
+static const GLchar* MAP_COLOR_FS_SRC = GLSL(330,
+in float state_color;
+out vec4 out_color;
+
+uniform int active_state;
+uniform int wrong_state;
+uniform bool border;
+
+vec3 color_hex(int c) {
+    return vec3(((c >> 16) & 255) / 255.0f,
+                ((c >>  8) & 255) / 255.0f,
+                ((c >>  0) & 255) / 255.0f);
+}
+
+void main() {
+    int t = int(state_color);
+    if (border) {
+        /* State-state edge */
+        out_color = vec4(color_hex(0x2E7D32), 1.0f);
+    } else if (t == active_state) {
+        /* Active state (brighter) */
+        out_color = vec4(color_hex(0xFFB74D), 1.0f);
+    } else if (t == wrong_state) {
+        /* Incorrect state (red) */
+        out_color = vec4(color_hex(0xE57373), 1.0f);
+    } else {
+        /*  Normal state */
+        out_color = vec4(color_hex(0x9CCC65), 1.0f);
+    }
+}
+);
+
 ////////////////////////////////////////////////////////////////////////////////
 
 struct map_ {
+    /*  Uniform values belong to the program, so every map that uses a
+     *  program must share its camera uniforms (including the record of
+     *  what was last uploaded).  These point into the owning map. */
     shader_t shader;
+    camera_uniforms_t* u_camera;
+
+    shader_t color;
+    camera_uniforms_t* u_color_camera;
+    GLint u_active_state;
+    GLint u_wrong_state;
+    GLint u_border;
 
     GLuint vao;
     GLuint vbo;
     GLuint ibo;
 
+    /*  State outlines, drawn as lines */
+    GLuint edge_vao;
+    GLuint edge_ibo;
+
     mat4_t model_mat;
 
-    camera_uniforms_t u_camera;
+    /*  If set, the programs and buffers belong to another map */
+    bool shared;
+
+    /*  Storage for the camera uniforms, used if the map owns its programs */
+    camera_uniforms_t shader_uniforms;
+    camera_uniforms_t color_uniforms;
 };
 
-map_t* map_new(camera_t* camera) {
-    OBJECT_ALLOC(map);
-    map->shader = shader_new(MAP_VS_SRC, NULL, MAP_FS_SRC);
-    map->u_camera = camera_get_uniforms(map->shader.prog);
+/*  Builds a VAO that reads positions from the vertex buffer, using the
+ *  given index buffer.  VAOs can't be shared between contexts, so every
+ *  map builds its own. */
+static GLuint map_vao_new(GLuint vbo, GLuint ibo) {
+    GLuint vao;
+    glGenVertexArrays(1, &vao);
+    glBindVertexArray(vao);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, 0);
+    return vao;
+}
 
-    glGenVertexArrays(1, &map->vao);
-    glBindVertexArray(map->vao);
+/*  Uploads data into a new buffer.  This uses the array buffer target,
+ *  since the element array binding is part of the current VAO. */
+static GLuint map_buffer_new(const void* data, size_t size) {
+    GLuint buf;
+    glGenBuffers(1, &buf);
+    glBindBuffer(GL_ARRAY_BUFFER, buf);
+    glBufferData(GL_ARRAY_BUFFER, size, data, GL_STATIC_DRAW);
+    return buf;
+}
 
-    // Find the bounding box of the map
-    float xmin = STATES_VERTS[0];
-    float xmax = STATES_VERTS[0];
-    float ymin = STATES_VERTS[1];
-    float ymax = STATES_VERTS[1];
+/*  Finds the bounding box of a single state (1-indexed, matching the
+ *  z coordinate of the vertex data), or of the whole map if state is 0 */
+static map_bounds_t map_bounds_of(unsigned state) {
+    float xmin = INFINITY;
+    float xmax = -INFINITY;
+    float ymin = INFINITY;
+    float ymax = -INFINITY;
     for (unsigned i=0; i < STATES_VERT_COUNT; i++) {
+        if (state && STATES_VERTS[3*i + 2] != state) {
+            continue;
+        }
         xmin = fminf(xmin, STATES_VERTS[3*i]);
         xmax = fmaxf(xmax, STATES_VERTS[3*i]);
         ymin = fminf(ymin, STATES_VERTS[3*i + 1]);
         ymax = fmaxf(ymax, STATES_VERTS[3*i + 1]);
     }
-    float scale = fmaxf(xmax - xmin, ymax - ymin);
-    float center[3] = {(xmin + xmax) / 2.0f, (ymin + ymax) / 2.0f, 0.0f};
-    camera_set_model(camera, center, scale / 2);
-
-    glGenBuffers(1, &map->vbo);
-    glBindBuffer(GL_ARRAY_BUFFER, map->vbo);
-    glBufferData(GL_ARRAY_BUFFER,
-                 STATES_VERT_COUNT * 3 * sizeof(float),
-                 STATES_VERTS, GL_STATIC_DRAW);
-
-    glGenBuffers(1, &map->ibo);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, map->ibo);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER,
-                 STATES_TRI_COUNT * 3 * sizeof(uint16_t),
-                 STATES_INDEXES, GL_STATIC_DRAW);
+    return (map_bounds_t){
+        .center = {(xmin + xmax) / 2.0f, (ymin + ymax) / 2.0f, 0.0f},
+        .scale = fmaxf(xmax - xmin, ymax - ymin),
+    };
+}
 
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, 0);
+map_bounds_t map_bounds(void) {
+    return map_bounds_of(0);
+}
+
+map_bounds_t map_state_bounds(unsigned state) {
+    if (!state || state > STATES_COUNT) {
+        log_error_and_abort("Invalid state %u", state);
+    }
+    return map_bounds_of(state);
+}
+
+map_t* map_new(camera_t* camera, map_bounds_t bounds, const map_t* share) {
+    TRACE_BEGIN("map_new");
+    OBJECT_ALLOC(map);
+    if (share) {
+        /*  Copy handles and uniform pointers, which are the same in
+         *  every context that shares objects with the original map */
+        *map = *share;
+        map->shared = true;
+    } else {
+        map->shader = shader_new(MAP_VS_SRC, NULL, MAP_FS_SRC);
+        map->shader_uniforms = camera_get_uniforms(map->shader.prog);
+        map->u_camera = &map->shader_uniforms;
+
+        map->color = shader_new(MAP_VS_SRC, NULL, MAP_COLOR_FS_SRC);
+        map->color_uniforms = camera_get_uniforms(map->color.prog);
+        map->u_color_camera = &map->color_uniforms;
+        {   /* Make a temporary struct to unpack local uniforms */
+            GLint prog = map->color.prog;
+            struct { GLint active_state, wrong_state, border; } u;
+            SHADER_GET_UNIFORM(active_state);
+            SHADER_GET_UNIFORM(wrong_state);
+            SHADER_GET_UNIFORM(border);
+            map->u_active_state = u.active_state;
+            map->u_wrong_state = u.wrong_state;
+            map->u_border = u.border;
+        }
+
+        map->vbo = map_buffer_new(STATES_VERTS,
+                                  STATES_VERT_COUNT * 3 * sizeof(float));
+        map->ibo = map_buffer_new(STATES_INDEXES,
+                                  STATES_TRI_COUNT * 3 * sizeof(uint16_t));
+        map->edge_ibo = map_buffer_new(
+                STATES_EDGES, STATES_EDGE_COUNT * 2 * sizeof(uint16_t));
+    }
+
+    /*  State outlines are drawn with the same vertex buffer */
+    map->vao = map_vao_new(map->vbo, map->ibo);
+    map->edge_vao = map_vao_new(map->vbo, map->edge_ibo);
+
+    camera_set_model(camera, bounds.center, bounds.scale / 2);
 
     log_trace("Finished building map");
     log_gl_error();
+    TRACE_END("map_new");
     return map;
 }
 
 void map_delete(map_t* map) {
-    shader_deinit(map->shader);
     glDeleteVertexArrays(1, &map->vao);
-    glDeleteBuffers(1, &map->vbo);
-    glDeleteBuffers(1, &map->ibo);
+    glDeleteVertexArrays(1, &map->edge_vao);
+    if (!map->shared) {
+        shader_deinit(map->shader);
+        shader_deinit(map->color);
+        glDeleteBuffers(1, &map->vbo);
+        glDeleteBuffers(1, &map->ibo);
+        glDeleteBuffers(1, &map->edge_ibo);
+    }
     free(map);
 }
 
-void map_draw(map_t* map, camera_t* camera) {
+void map_draw(map_t* map, camera_t* camera,
+              int active_state, int wrong_state)
+{
+    TRACE_BEGIN("map_draw");
+    glDisable(GL_DEPTH_TEST);
+
+    glUseProgram(map->color.prog);
+    camera_bind(camera, map->u_color_camera);
+    glUniform1i(map->u_active_state, active_state);
+    glUniform1i(map->u_wrong_state, wrong_state);
+
+    glUniform1i(map->u_border, 0);
+    glBindVertexArray(map->vao);
+    glDrawElements(GL_TRIANGLES, STATES_TRI_COUNT * 3,
+                   GL_UNSIGNED_SHORT, NULL);
+
+    glUniform1i(map->u_border, 1);
+    glBindVertexArray(map->edge_vao);
+    glDrawElements(GL_LINES, STATES_EDGE_COUNT * 2,
+                   GL_UNSIGNED_SHORT, NULL);
+
+    log_gl_error();
+    TRACE_END("map_draw");
+}
+
+void map_draw_ids(map_t* map, camera_t* camera) {
+    TRACE_BEGIN("map_draw_ids");
     glDisable(GL_DEPTH_TEST);
 
     glUseProgram(map->shader.prog);
@@ -107,4 +252,5 @@ void map_draw(map_t* map, camera_t* camera) {
                    GL_UNSIGNED_SHORT, NULL);
 
     log_gl_error();
+    TRACE_END("map_draw_ids");
 }
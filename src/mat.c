@@ -3,6 +3,16 @@
 #include "mat.h"
 #include "log.h"
 
+/*  Pick a SIMD implementation, falling back to scalar code.  Build with
+ *  -DMAT_NO_SIMD to force the scalar path. */
+#if !defined(MAT_NO_SIMD) && (defined(__SSE__) || defined(_M_X64))
+#define MAT_SSE
+#include <xmmintrin.h>
+#elif !defined(MAT_NO_SIMD) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#define MAT_NEON
+#include <arm_neon.h>
+#endif
+
 mat4_t mat4_identity() {
     mat4_t out;
     memset(&out, 0, sizeof(float) * 4 * 4);
@@ -28,25 +38,91 @@ mat4_t mat4_scaling(const float s) {
     return out;
 }
 
-mat4_t mat4_mul(const mat4_t a, const mat4_t b) {
+mat4_t mat4_mul(const mat4_t* a, const mat4_t* b) {
     mat4_t out;
+#if defined(MAT_SSE)
+    const __m128 b0 = _mm_loadu_ps(b->m[0]);
+    const __m128 b1 = _mm_loadu_ps(b->m[1]);
+    const __m128 b2 = _mm_loadu_ps(b->m[2]);
+    const __m128 b3 = _mm_loadu_ps(b->m[3]);
+    for (unsigned i=0; i < 4; ++i) {
+        const __m128 r = _mm_add_ps(
+            _mm_add_ps(_mm_mul_ps(_mm_set1_ps(a->m[i][0]), b0),
+                       _mm_mul_ps(_mm_set1_ps(a->m[i][1]), b1)),
+            _mm_add_ps(_mm_mul_ps(_mm_set1_ps(a->m[i][2]), b2),
+                       _mm_mul_ps(_mm_set1_ps(a->m[i][3]), b3)));
+        _mm_storeu_ps(out.m[i], r);
+    }
+#elif defined(MAT_NEON)
+    const float32x4_t b0 = vld1q_f32(b->m[0]);
+    const float32x4_t b1 = vld1q_f32(b->m[1]);
+    const float32x4_t b2 = vld1q_f32(b->m[2]);
+    const float32x4_t b3 = vld1q_f32(b->m[3]);
     for (unsigned i=0; i < 4; ++i) {
-       for (unsigned j=0; j < 4; ++j) {
-           out.m[i][j] = 0.0f;
-           for (unsigned k=0; k < 4; ++k) {
-               out.m[i][j] += a.m[i][k] * b.m[k][j];
-           }
-       }
-   }
+        float32x4_t r = vmulq_n_f32(b0, a->m[i][0]);
+        r = vmlaq_n_f32(r, b1, a->m[i][1]);
+        r = vmlaq_n_f32(r, b2, a->m[i][2]);
+        r = vmlaq_n_f32(r, b3, a->m[i][3]);
+        vst1q_f32(out.m[i], r);
+    }
+#else
+    for (unsigned i=0; i < 4; ++i) {
+        for (unsigned j=0; j < 4; ++j) {
+            out.m[i][j] = 0.0f;
+            for (unsigned k=0; k < 4; ++k) {
+                out.m[i][j] += a->m[i][k] * b->m[k][j];
+            }
+        }
+    }
+#endif
     return out;
 }
 
-vec3_t mat4_apply(const mat4_t m, const vec3_t v) {
-    float w[4] = {v.v[0], v.v[1], v.v[2], 1.0f};
+/*  Applies a matrix to a single point, with the homogeneous divide.
+ *  The SIMD versions take the matrix rows pre-loaded into registers, so
+ *  that mat4_apply_n only loads them once. */
+#if defined(MAT_SSE)
+static inline vec3_t mat4_apply_rows(__m128 r0, __m128 r1, __m128 r2,
+                                     __m128 r3, const vec3_t* v)
+{
+    __m128 o = _mm_add_ps(
+        _mm_add_ps(_mm_mul_ps(_mm_set1_ps(v->v[0]), r0),
+                   _mm_mul_ps(_mm_set1_ps(v->v[1]), r1)),
+        _mm_add_ps(_mm_mul_ps(_mm_set1_ps(v->v[2]), r2), r3));
+    o = _mm_div_ps(o, _mm_shuffle_ps(o, o, _MM_SHUFFLE(3, 3, 3, 3)));
+    float f[4];
+    _mm_storeu_ps(f, o);
+    return (vec3_t){{f[0], f[1], f[2]}};
+}
+#define MAT4_LOAD_ROWS(m)                   \
+    const __m128 r0 = _mm_loadu_ps(m->m[0]); \
+    const __m128 r1 = _mm_loadu_ps(m->m[1]); \
+    const __m128 r2 = _mm_loadu_ps(m->m[2]); \
+    const __m128 r3 = _mm_loadu_ps(m->m[3])
+#elif defined(MAT_NEON)
+static inline vec3_t mat4_apply_rows(float32x4_t r0, float32x4_t r1,
+                                     float32x4_t r2, float32x4_t r3,
+                                     const vec3_t* v)
+{
+    float32x4_t o = vmlaq_n_f32(r3, r0, v->v[0]);
+    o = vmlaq_n_f32(o, r1, v->v[1]);
+    o = vmlaq_n_f32(o, r2, v->v[2]);
+    float f[4];
+    vst1q_f32(f, o);
+    return (vec3_t){{f[0] / f[3], f[1] / f[3], f[2] / f[3]}};
+}
+#define MAT4_LOAD_ROWS(m)                       \
+    const float32x4_t r0 = vld1q_f32(m->m[0]);  \
+    const float32x4_t r1 = vld1q_f32(m->m[1]);  \
+    const float32x4_t r2 = vld1q_f32(m->m[2]);  \
+    const float32x4_t r3 = vld1q_f32(m->m[3])
+#else
+static inline vec3_t mat4_apply_scalar(const mat4_t* m, const vec3_t* v) {
+    const float w[4] = {v->v[0], v->v[1], v->v[2], 1.0f};
     float o[4] = {0.0f};
     for (unsigned i=0; i < 4; ++i) {
         for (unsigned j=0; j < 4; ++j) {
-            o[i] += m.m[j][i] * w[j];
+            o[i] += m->m[j][i] * w[j];
         }
     }
     vec3_t out;
@@ -55,79 +131,80 @@ vec3_t mat4_apply(const mat4_t m, const vec3_t v) {
     }
     return out;
 }
+#endif
+
+vec3_t mat4_apply(const mat4_t* m, const vec3_t v) {
+#if defined(MAT_SSE) || defined(MAT_NEON)
+    MAT4_LOAD_ROWS(m);
+    return mat4_apply_rows(r0, r1, r2, r3, &v);
+#else
+    return mat4_apply_scalar(m, &v);
+#endif
+}
+
+void mat4_apply_n(const mat4_t* m, const vec3_t* in, vec3_t* out, size_t n) {
+#if defined(MAT_SSE) || defined(MAT_NEON)
+    MAT4_LOAD_ROWS(m);
+    for (size_t i=0; i < n; ++i) {
+        out[i] = mat4_apply_rows(r0, r1, r2, r3, &in[i]);
+    }
+#else
+    for (size_t i=0; i < n; ++i) {
+        out[i] = mat4_apply_scalar(m, &in[i]);
+    }
+#endif
+}
+
+/*  Inverts a matrix using the 2x2 sub-determinants of its top and bottom
+ *  halves, which are shared between cofactors (rather than expanding each
+ *  cofactor separately).  Returns the identity if the matrix is singular. */
+mat4_t mat4_inv(const mat4_t* in) {
+    const float (*a)[4] = in->m;
 
-mat4_t mat4_inv(const mat4_t in) {
-   const float a00 = in.m[0][0];
-   const float a01 = in.m[0][1];
-   const float a02 = in.m[0][2];
-   const float a03 = in.m[0][3];
-   const float a10 = in.m[1][0];
-   const float a11 = in.m[1][1];
-   const float a12 = in.m[1][2];
-   const float a13 = in.m[1][3];
-   const float a20 = in.m[2][0];
-   const float a21 = in.m[2][1];
-   const float a22 = in.m[2][2];
-   const float a23 = in.m[2][3];
-   const float a30 = in.m[3][0];
-   const float a31 = in.m[3][1];
-   const float a32 = in.m[3][2];
-   const float a33 = in.m[3][3];
-
-   const float det = a00*a11*a22*a33 + a00*a12*a23*a31 + a00*a13*a21*a32
-                   + a01*a10*a23*a32 + a01*a12*a20*a33 + a01*a13*a22*a30
-                   + a02*a10*a21*a33 + a02*a11*a23*a30 + a02*a13*a20*a31
-                   + a03*a10*a22*a31 + a03*a11*a20*a32 + a03*a12*a21*a30
-                   - a00*a11*a23*a32 - a00*a12*a21*a33 - a00*a13*a22*a31
-                   - a01*a10*a22*a33 - a01*a12*a23*a30 - a01*a13*a20*a32
-                   - a02*a10*a23*a31 - a02*a11*a20*a33 - a02*a13*a21*a30
-                   - a03*a10*a21*a32 - a03*a11*a22*a30 - a03*a12*a20*a31;
-
-   if (det == 0.0f) {
-       log_warn("Tried to invert noninvertible matrix");
-       return mat4_identity();
-   }
-
-   mat4_t out;
-   out.m[0][0] = a11*a22*a33 + a12*a23*a31 + a13*a21*a32
-               - a11*a23*a32 - a12*a21*a33 - a13*a22*a31;
-   out.m[0][1] = a01*a23*a32 + a02*a21*a33 + a03*a22*a31
-               - a01*a22*a33 - a02*a23*a31 - a03*a21*a32;
-   out.m[0][2] = a01*a12*a33 + a02*a13*a31 + a03*a11*a32
-               - a01*a13*a32 - a02*a11*a33 - a03*a12*a31;
-   out.m[0][3] = a01*a13*a22 + a02*a11*a23 + a03*a12*a21
-               - a01*a12*a23 - a02*a13*a21 - a03*a11*a22;
-   out.m[1][0] = a10*a23*a32 + a12*a20*a33 + a13*a22*a30
-               - a10*a22*a33 - a12*a23*a30 - a13*a20*a32;
-   out.m[1][1] = a00*a22*a33 + a02*a23*a30 + a03*a20*a32
-               - a00*a23*a32 - a02*a20*a33 - a03*a22*a30;
-   out.m[1][2] = a00*a13*a32 + a02*a10*a33 + a03*a12*a30
-               - a00*a12*a33 - a02*a13*a30 - a03*a10*a32;
-   out.m[1][3] = a00*a12*a23 + a02*a13*a20 + a03*a10*a22
-               - a00*a13*a22 - a02*a10*a23 - a03*a12*a20;
-   out.m[2][0] = a10*a21*a33 + a11*a23*a30 + a13*a20*a31
-               - a10*a23*a31 - a11*a20*a33 - a13*a21*a30;
-   out.m[2][1] = a00*a23*a31 + a01*a20*a33 + a03*a21*a30
-               - a00*a21*a33 - a01*a23*a30 - a03*a20*a31;
-   out.m[2][2] = a00*a11*a33 + a01*a13*a30 + a03*a10*a31
-               - a00*a13*a31 - a01*a10*a33 - a03*a11*a30;
-   out.m[2][3] = a00*a13*a21 + a01*a10*a23 + a03*a11*a20
-               - a00*a11*a23 - a01*a13*a20 - a03*a10*a21;
-   out.m[3][0] = a10*a22*a31 + a11*a20*a32 + a12*a21*a30
-               - a10*a21*a32 - a11*a22*a30 - a12*a20*a31;
-   out.m[3][1] = a00*a21*a32 + a01*a22*a30 + a02*a20*a31
-               - a00*a22*a31 - a01*a20*a32 - a02*a21*a30;
-   out.m[3][2] = a00*a12*a31 + a01*a10*a32 + a02*a11*a30
-               - a00*a11*a32 - a01*a12*a30 - a02*a10*a31;
-   out.m[3][3] = a00*a11*a22 + a01*a12*a20 + a02*a10*a21
-               - a00*a12*a21 - a01*a10*a22 - a02*a11*a20;
-
-   for (unsigned i=0; i < 4; ++i) {
-       for (unsigned j=0; j < 4; ++j) {
-           out.m[i][j] /= det;
-       }
-   }
-   return out;
+    /*  2x2 determinants from the top two rows */
+    const float s0 = a[0][0] * a[1][1] - a[1][0] * a[0][1];
+    const float s1 = a[0][0] * a[1][2] - a[1][0] * a[0][2];
+    const float s2 = a[0][0] * a[1][3] - a[1][0] * a[0][3];
+    const float s3 = a[0][1] * a[1][2] - a[1][1] * a[0][2];
+    const float s4 = a[0][1] * a[1][3] - a[1][1] * a[0][3];
+    const float s5 = a[0][2] * a[1][3] - a[1][2] * a[0][3];
+
+    /*  2x2 determinants from the bottom two rows */
+    const float c5 = a[2][2] * a[3][3] - a[3][2] * a[2][3];
+    const float c4 = a[2][1] * a[3][3] - a[3][1] * a[2][3];
+    const float c3 = a[2][1] * a[3][2] - a[3][1] * a[2][2];
+    const float c2 = a[2][0] * a[3][3] - a[3][0] * a[2][3];
+    const float c1 = a[2][0] * a[3][2] - a[3][0] * a[2][2];
+    const float c0 = a[2][0] * a[3][1] - a[3][0] * a[2][1];
+
+    const float det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+    if (det == 0.0f) {
+        log_warn("Tried to invert noninvertible matrix");
+        return mat4_identity();
+    }
+    const float d = 1.0f / det;
+
+    mat4_t out;
+    out.m[0][0] = ( a[1][1] * c5 - a[1][2] * c4 + a[1][3] * c3) * d;
+    out.m[0][1] = (-a[0][1] * c5 + a[0][2] * c4 - a[0][3] * c3) * d;
+    out.m[0][2] = ( a[3][1] * s5 - a[3][2] * s4 + a[3][3] * s3) * d;
+    out.m[0][3] = (-a[2][1] * s5 + a[2][2] * s4 - a[2][3] * s3) * d;
+
+    out.m[1][0] = (-a[1][0] * c5 + a[1][2] * c2 - a[1][3] * c1) * d;
+    out.m[1][1] = ( a[0][0] * c5 - a[0][2] * c2 + a[0][3] * c1) * d;
+    out.m[1][2] = (-a[3][0] * s5 + a[3][2] * s2 - a[3][3] * s1) * d;
+    out.m[1][3] = ( a[2][0] * s5 - a[2][2] * s2 + a[2][3] * s1) * d;
+
+    out.m[2][0] = ( a[1][0] * c4 - a[1][1] * c2 + a[1][3] * c0) * d;
+    out.m[2][1] = (-a[0][0] * c4 + a[0][1] * c2 - a[0][3] * c0) * d;
+    out.m[2][2] = ( a[3][0] * s4 - a[3][1] * s2 + a[3][3] * s0) * d;
+    out.m[2][3] = (-a[2][0] * s4 + a[2][1] * s2 - a[2][3] * s0) * d;
+
+    out.m[3][0] = (-a[1][0] * c3 + a[1][1] * c1 - a[1][2] * c0) * d;
+    out.m[3][1] = ( a[0][0] * c3 - a[0][1] * c1 + a[0][2] * c0) * d;
+    out.m[3][2] = (-a[3][0] * s3 + a[3][1] * s1 - a[3][2] * s0) * d;
+    out.m[3][3] = ( a[2][0] * s3 - a[2][1] * s1 + a[2][2] * s0) * d;
+    return out;
 }
 
 float vec3_length(const vec3_t v) {
@@ -0,0 +1,218 @@
+#include "log.h"
+#include "match.h"
+#include "object.h"
+
+/*  Each node stores a name and its distance from its parent.  Children
+ *  are kept as a linked list through next, with 0 as the terminator
+ *  (which is safe because node 0 is the root, so it's never a child). */
+typedef struct {
+    unsigned dist;
+    unsigned child;
+    unsigned next;
+} match_node_t;
+
+struct match_ {
+    const char** names;
+    unsigned count;
+
+    match_node_t* nodes;
+
+    /*  Scratch space for traversal in match_find */
+    unsigned* stack;
+};
+
+/*  A string prepared for repeated distance calculations.  eq holds
+ *  bitmasks of where each character occurs, if the string is short
+ *  enough for the bit-parallel algorithm. */
+typedef struct {
+    const char* str;
+    unsigned len;
+    bool bits;
+    uint64_t eq[256];
+} match_pattern_t;
+
+////////////////////////////////////////////////////////////////////////////////
+
+static unsigned char match_fold(char c) {
+    return (c >= 'A' && c <= 'Z') ? (c - 'A' + 'a') : (unsigned char)c;
+}
+
+/*  Fallback for patterns longer than 64 characters, using the
+ *  classic dynamic-programming algorithm with two rows */
+static unsigned match_distance_dp(const char* a, const char* b) {
+    const size_t m = strlen(a);
+    const size_t n = strlen(b);
+    unsigned* row = malloc((m + 1) * sizeof(unsigned));
+    for (size_t i=0; i <= m; ++i) {
+        row[i] = i;
+    }
+    for (size_t j=1; j <= n; ++j) {
+        unsigned diag = row[0];
+        row[0] = j;
+        for (size_t i=1; i <= m; ++i) {
+            const unsigned up = row[i];
+            const unsigned sub = diag +
+                (match_fold(a[i - 1]) != match_fold(b[j - 1]));
+            unsigned best = (up < row[i - 1] ? up : row[i - 1]) + 1;
+            if (sub < best) {
+                best = sub;
+            }
+            diag = up;
+            row[i] = best;
+        }
+    }
+    const unsigned out = row[m];
+    free(row);
+    return out;
+}
+
+static void match_pattern_init(match_pattern_t* p, const char* s) {
+    p->str = s;
+    p->len = strlen(s);
+    p->bits = (p->len <= 64);
+    if (p->bits) {
+        memset(p->eq, 0, sizeof(p->eq));
+        for (unsigned i=0; i < p->len; ++i) {
+            p->eq[match_fold(s[i])] |= 1ULL << i;
+        }
+    }
+}
+
+/*  Myers' bit-parallel edit distance (in Hyyrö's formulation for global
+ *  alignment), which processes one column of the DP matrix per text
+ *  character using a handful of word operations. */
+static unsigned match_distance_bits(const match_pattern_t* p,
+                                    const char* text)
+{
+    if (p->len == 0) {
+        return strlen(text);
+    }
+    const uint64_t last = 1ULL << (p->len - 1);
+    uint64_t pv = (p->len == 64) ? ~0ULL : ((1ULL << p->len) - 1);
+    uint64_t mv = 0;
+    unsigned score = p->len;
+
+    for (const char* c = text; *c; ++c) {
+        const uint64_t eq = p->eq[match_fold(*c)];
+        const uint64_t xv = eq | mv;
+        const uint64_t xh = (((eq & pv) + pv) ^ pv) | eq;
+        uint64_t ph = mv | ~(xh | pv);
+        uint64_t mh = pv & xh;
+        if (ph & last) {
+            score++;
+        } else if (mh & last) {
+            score--;
+        }
+        /*  The top row of the matrix increases by one in each column */
+        ph = (ph << 1) | 1;
+        mh <<= 1;
+        pv = mh | ~(xv | ph);
+        mv = ph & xv;
+    }
+    return score;
+}
+
+static unsigned match_pattern_distance(const match_pattern_t* p,
+                                       const char* text)
+{
+    return p->bits ? match_distance_bits(p, text)
+                   : match_distance_dp(p->str, text);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+unsigned match_distance(const char* a, const char* b) {
+    match_pattern_t p;
+    match_pattern_init(&p, a);
+    return match_pattern_distance(&p, b);
+}
+
+unsigned match_tolerance(const char* name) {
+    const unsigned n = strlen(name) / 4;
+    return n ? n : 1;
+}
+
+match_t* match_new(const char** names, unsigned count) {
+    OBJECT_ALLOC(match);
+    match->names = names;
+    match->count = count;
+    match->nodes = calloc(count ? count : 1, sizeof(match_node_t));
+    match->stack = malloc((count ? count : 1) * sizeof(unsigned));
+
+    /*  Insert each name below the root, walking down the child whose
+     *  distance matches until we find an empty spot. */
+    for (unsigned i=1; i < count; ++i) {
+        match_pattern_t p;
+        match_pattern_init(&p, names[i]);
+        unsigned n = 0;
+        while (true) {
+            const unsigned d = match_pattern_distance(&p, names[n]);
+            if (d == 0) {
+                log_warn("Duplicate name '%s' in matcher", names[i]);
+                break;
+            }
+            unsigned c = match->nodes[n].child;
+            while (c && match->nodes[c].dist != d) {
+                c = match->nodes[c].next;
+            }
+            if (c) {
+                n = c;
+            } else {
+                match->nodes[i].dist = d;
+                match->nodes[i].next = match->nodes[n].child;
+                match->nodes[n].child = i;
+                break;
+            }
+        }
+    }
+    return match;
+}
+
+void match_delete(match_t* match) {
+    free(match->nodes);
+    free(match->stack);
+    free(match);
+}
+
+unsigned match_find(match_t* match, const char* input,
+                    unsigned max_dist, unsigned* dist)
+{
+    unsigned best = 0;
+    unsigned best_dist = max_dist + 1;
+    if (!match->count) {
+        return 0;
+    }
+
+    match_pattern_t p;
+    match_pattern_init(&p, input);
+
+    /*  Depth-first search, tightening the radius as closer names are found.
+     *  By the triangle inequality, a child at distance c from its parent
+     *  can only be within r of the input if |c - d| <= r, where d is the
+     *  parent's distance from the input. */
+    unsigned top = 0;
+    match->stack[top++] = 0;
+    while (top) {
+        const unsigned n = match->stack[--top];
+        const unsigned d = match_pattern_distance(&p, match->names[n]);
+        if (d < best_dist) {
+            best = n + 1;
+            best_dist = d;
+            if (d == 0) {
+                break;
+            }
+        }
+        const unsigned r = best_dist - 1;
+        for (unsigned c = match->nodes[n].child; c; c = match->nodes[c].next) {
+            const unsigned cd = match->nodes[c].dist;
+            if (cd + r >= d && cd <= d + r) {
+                match->stack[top++] = c;
+            }
+        }
+    }
+
+    if (best && dist) {
+        *dist = best_dist;
+    }
+    return best;
+}
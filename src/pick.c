@@ -0,0 +1,133 @@
+#include "log.h"
+#include "object.h"
+#include "pick.h"
+#include "trace.h"
+
+struct pick_ {
+    float scale;
+
+    GLuint fbo;
+    GLuint tex;
+
+    /*  Size of the framebuffer, and of the (scaled) texture */
+    uint32_t fb_width;
+    uint32_t fb_height;
+    uint32_t width;
+    uint32_t height;
+
+    /*  Camera generation when the texture was last drawn */
+    uint32_t generation;
+    bool valid;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+void pick_resize(pick_t* pick, uint32_t width, uint32_t height) {
+    TRACE_BEGIN("pick_resize");
+    pick->fb_width = width;
+    pick->fb_height = height;
+    pick->width = fmaxf(1.0f, ceilf(width * pick->scale));
+    pick->height = fmaxf(1.0f, ceilf(height * pick->scale));
+    log_trace("Resizing to %u x %u", pick->width, pick->height);
+
+    glBindTexture(GL_TEXTURE_2D, pick->tex);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_R32I, pick->width, pick->height, 0,
+                 GL_RED_INTEGER, GL_INT, NULL);
+    pick->valid = false;
+    log_gl_error();
+    TRACE_END("pick_resize");
+}
+
+pick_t* pick_new(float scale, uint32_t width, uint32_t height) {
+    TRACE_BEGIN("pick_new");
+    OBJECT_ALLOC(pick);
+    pick->scale = scale;
+
+    glGenFramebuffers(1, &pick->fbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, pick->fbo);
+
+    glGenTextures(1, &pick->tex);
+
+    pick_resize(pick, width, height);
+
+    /* Bind the color output buffer, which is a texture */
+    glBindTexture(GL_TEXTURE_2D, pick->tex);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+                           GL_TEXTURE_2D, pick->tex, 0);
+
+    /* Configure the framebuffer to draw to one color buffer */
+    GLuint attachments[1] = {GL_COLOR_ATTACHMENT0};
+    glDrawBuffers(1, attachments);
+
+    GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+    if (status != GL_FRAMEBUFFER_COMPLETE) {
+        const char* err = NULL;
+        switch (status) {
+#define LOG_FB_ERR_CASE(s) case s: err = #s; break
+            LOG_FB_ERR_CASE(GL_FRAMEBUFFER_INCOMPLETE_ATTACHMENT);
+            LOG_FB_ERR_CASE(GL_FRAMEBUFFER_INCOMPLETE_MISSING_ATTACHMENT);
+            LOG_FB_ERR_CASE(GL_FRAMEBUFFER_UNSUPPORTED);
+            default: break;
+#undef LOG_FB_ERR_CASE
+        }
+        if (err) {
+            log_error_and_abort("Framebuffer error: %s (0x%x)", err, status);
+        } else {
+            log_error_and_abort("Unknown framebuffer error: %u", status);
+        }
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    TRACE_END("pick_new");
+    return pick;
+}
+
+void pick_delete(pick_t* pick) {
+    glDeleteFramebuffers(1, &pick->fbo);
+    glDeleteTextures(1, &pick->tex);
+    free(pick);
+}
+
+bool pick_begin(pick_t* pick, uint32_t generation) {
+    if (pick->valid && pick->generation == generation) {
+        return false;
+    }
+    pick->valid = true;
+    pick->generation = generation;
+
+    glBindFramebuffer(GL_FRAMEBUFFER, pick->fbo);
+    glViewport(0, 0, pick->width, pick->height);
+
+    /*  Integer buffers must be cleared with glClearBuffer */
+    const GLint ocean[4] = {0, 0, 0, 0};
+    glClearBufferiv(GL_COLOR, 0, ocean);
+    return true;
+}
+
+void pick_end(pick_t* pick) {
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glViewport(0, 0, pick->fb_width, pick->fb_height);
+}
+
+int pick_state_at(pick_t* pick, int x, int y) {
+    /*  The framebuffer is empty while the window is minimized */
+    if (!pick->fb_width || !pick->fb_height) {
+        return 0;
+    }
+    TRACE_BEGIN("pick_state_at");
+    /*  Scale from framebuffer to texture pixels, clamping to the edges
+     *  (since the mouse can be reported slightly outside the window) */
+    x = (int64_t)x * pick->width / pick->fb_width;
+    y = (int64_t)y * pick->height / pick->fb_height;
+    x = (x < 0) ? 0 : ((x >= (int)pick->width) ? (int)pick->width - 1 : x);
+    y = (y < 0) ? 0 : ((y >= (int)pick->height) ? (int)pick->height - 1 : y);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, pick->fbo);
+    int out;
+    glReadPixels(x, y, 1, 1, GL_RED_INTEGER, GL_INT, &out);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    TRACE_END("pick_state_at");
+    return out;
+}
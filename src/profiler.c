@@ -0,0 +1,234 @@
+#include "gui.h"
+#include "log.h"
+#include "object.h"
+#include "platform.h"
+#include "profiler.h"
+
+/*  Number of frames of GPU queries in flight.  Results are read back
+ *  this many frames later, so the CPU never waits on the GPU. */
+#define PROFILER_LATENCY 2
+
+/*  Number of frames stored for averaging and CSV export */
+#define PROFILER_HISTORY 512
+
+/*  Number of frames averaged in the overlay */
+#define PROFILER_AVERAGE 32
+
+static const char* PROFILER_PASS_NAMES[PROFILER_PASS_COUNT] = {
+    "map",
+    "gui",
+};
+
+typedef struct {
+    uint64_t frame;
+
+    /*  All times are in microseconds.  GPU times are -1 until results
+     *  have been read back (or if the queries were skipped). */
+    int64_t cpu_frame;
+    int64_t cpu[PROFILER_PASS_COUNT];
+    int64_t gpu[PROFILER_PASS_COUNT];
+} profiler_frame_t;
+
+struct profiler_ {
+    GLuint queries[PROFILER_LATENCY][PROFILER_PASS_COUNT];
+
+    /*  Which queries were issued for each set, and for which frame */
+    bool issued[PROFILER_LATENCY][PROFILER_PASS_COUNT];
+    bool pending[PROFILER_LATENCY];
+    uint64_t pending_frame[PROFILER_LATENCY];
+
+    /*  Set to false if the current query set is still in flight */
+    bool gpu_active;
+
+    /*  Start times are in nanoseconds */
+    uint64_t frame;
+    int64_t frame_start;
+    int64_t pass_start[PROFILER_PASS_COUNT];
+
+    profiler_frame_t history[PROFILER_HISTORY];
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+static profiler_frame_t* profiler_history(profiler_t* profiler,
+                                          uint64_t frame)
+{
+    return &profiler->history[frame % PROFILER_HISTORY];
+}
+
+/*  Reads back a set of queries if they're all available.
+ *  Returns false if the queries are still in flight. */
+static bool profiler_collect(profiler_t* profiler, unsigned set) {
+    for (unsigned i=0; i < PROFILER_PASS_COUNT; ++i) {
+        if (profiler->issued[set][i]) {
+            GLint available = 0;
+            glGetQueryObjectiv(profiler->queries[set][i],
+                               GL_QUERY_RESULT_AVAILABLE, &available);
+            if (!available) {
+                return false;
+            }
+        }
+    }
+
+    profiler_frame_t* f = profiler_history(profiler,
+                                           profiler->pending_frame[set]);
+    for (unsigned i=0; i < PROFILER_PASS_COUNT; ++i) {
+        if (profiler->issued[set][i]) {
+            GLuint64 ns = 0;
+            glGetQueryObjectui64v(profiler->queries[set][i],
+                                  GL_QUERY_RESULT, &ns);
+            f->gpu[i] = ns / 1000;
+        }
+        profiler->issued[set][i] = false;
+    }
+    profiler->pending[set] = false;
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+profiler_t* profiler_new(void) {
+    OBJECT_ALLOC(profiler);
+    for (unsigned i=0; i < PROFILER_LATENCY; ++i) {
+        glGenQueries(PROFILER_PASS_COUNT, profiler->queries[i]);
+    }
+    for (unsigned i=0; i < PROFILER_HISTORY; ++i) {
+        profiler->history[i].cpu_frame = -1;
+    }
+    log_gl_error();
+    return profiler;
+}
+
+void profiler_delete(profiler_t* profiler) {
+    for (unsigned i=0; i < PROFILER_LATENCY; ++i) {
+        glDeleteQueries(PROFILER_PASS_COUNT, profiler->queries[i]);
+    }
+    free(profiler);
+}
+
+void profiler_frame_begin(profiler_t* profiler) {
+    const unsigned set = profiler->frame % PROFILER_LATENCY;
+    profiler->gpu_active = !profiler->pending[set] ||
+                           profiler_collect(profiler, set);
+
+    /*  Also pick up any other sets that have finished early, so that
+     *  the overlay is as fresh as possible. */
+    for (unsigned i=0; i < PROFILER_LATENCY; ++i) {
+        if (i != set && profiler->pending[i]) {
+            profiler_collect(profiler, i);
+        }
+    }
+
+    profiler_frame_t* f = profiler_history(profiler, profiler->frame);
+    f->frame = profiler->frame;
+    f->cpu_frame = -1;
+    for (unsigned i=0; i < PROFILER_PASS_COUNT; ++i) {
+        f->cpu[i] = -1;
+        f->gpu[i] = -1;
+    }
+    profiler->frame_start = platform_get_time_ns();
+}
+
+void profiler_frame_end(profiler_t* profiler) {
+    profiler_frame_t* f = profiler_history(profiler, profiler->frame);
+    f->cpu_frame = (platform_get_time_ns() - profiler->frame_start) / 1000;
+
+    if (profiler->gpu_active) {
+        const unsigned set = profiler->frame % PROFILER_LATENCY;
+        profiler->pending[set] = true;
+        profiler->pending_frame[set] = profiler->frame;
+    }
+    profiler->frame++;
+}
+
+void profiler_begin(profiler_t* profiler, profiler_pass_t pass) {
+    if (profiler->gpu_active) {
+        const unsigned set = profiler->frame % PROFILER_LATENCY;
+        glBeginQuery(GL_TIME_ELAPSED, profiler->queries[set][pass]);
+    }
+    profiler->pass_start[pass] = platform_get_time_ns();
+}
+
+void profiler_end(profiler_t* profiler, profiler_pass_t pass) {
+    profiler_frame_t* f = profiler_history(profiler, profiler->frame);
+    const int64_t dt_ns = platform_get_time_ns() - profiler->pass_start[pass];
+    f->cpu[pass] = dt_ns / 1000;
+
+    if (profiler->gpu_active) {
+        const unsigned set = profiler->frame % PROFILER_LATENCY;
+        glEndQuery(GL_TIME_ELAPSED);
+        profiler->issued[set][pass] = true;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+/*  Averages a value over recent frames, skipping missing samples */
+static float profiler_average(profiler_t* profiler, int pass, bool gpu) {
+    int64_t sum = 0;
+    unsigned count = 0;
+    for (unsigned i=1; i <= PROFILER_AVERAGE && i <= profiler->frame; ++i) {
+        const profiler_frame_t* f = profiler_history(
+                profiler, profiler->frame - i);
+        const int64_t t = (pass < 0) ? f->cpu_frame
+                        : (gpu ? f->gpu[pass] : f->cpu[pass]);
+        if (t >= 0) {
+            sum += t;
+            count++;
+        }
+    }
+    return count ? (sum / (float)count / 1000.0f) : 0.0f;
+}
+
+void profiler_overlay(profiler_t* profiler, gui_t* gui, float aspect_ratio) {
+    const float y_top = -0.5f;
+    const float y_step = 0.09f;
+    gui_panel(gui, aspect_ratio, -0.95f, y_top + 0.02f);
+
+    char buf[64];
+    float y = y_top - y_step;
+    gui_print(gui, "\x01        gpu ms  cpu ms", aspect_ratio, y, 0);
+    for (unsigned i=0; i < PROFILER_PASS_COUNT; ++i) {
+        y -= y_step;
+        snprintf(buf, sizeof(buf), "\x01%-10s\x02%6.2f  %6.2f",
+                 PROFILER_PASS_NAMES[i],
+                 profiler_average(profiler, i, true),
+                 profiler_average(profiler, i, false));
+        gui_print(gui, buf, aspect_ratio, y, 0);
+    }
+    y -= y_step;
+    snprintf(buf, sizeof(buf), "\x01%-10s\x02    --  %6.2f", "frame",
+             profiler_average(profiler, -1, false));
+    gui_print(gui, buf, aspect_ratio, y, 0);
+}
+
+bool profiler_dump_csv(profiler_t* profiler, const char* filename) {
+    FILE* out = fopen(filename, "w");
+    if (!out) {
+        log_error("Could not open %s", filename);
+        return false;
+    }
+
+    fprintf(out, "frame,cpu_frame_us");
+    for (unsigned i=0; i < PROFILER_PASS_COUNT; ++i) {
+        fprintf(out, ",%s_cpu_us,%s_gpu_us",
+                PROFILER_PASS_NAMES[i], PROFILER_PASS_NAMES[i]);
+    }
+    fprintf(out, "\n");
+
+    /*  Write frames in order, oldest first */
+    const uint64_t start = (profiler->frame > PROFILER_HISTORY)
+        ? (profiler->frame - PROFILER_HISTORY) : 0;
+    for (uint64_t i=start; i < profiler->frame; ++i) {
+        const profiler_frame_t* f = profiler_history(profiler, i);
+        fprintf(out, "%llu,%lli", (unsigned long long)f->frame,
+                (long long)f->cpu_frame);
+        for (unsigned j=0; j < PROFILER_PASS_COUNT; ++j) {
+            fprintf(out, ",%lli,%lli", (long long)f->cpu[j],
+                    (long long)f->gpu[j]);
+        }
+        fprintf(out, "\n");
+    }
+    fclose(out);
+    return true;
+}
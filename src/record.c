@@ -0,0 +1,147 @@
+#include "log.h"
+#include "object.h"
+#include "platform.h"
+#include "record.h"
+
+/*  Header line, which identifies the file format */
+#define RECORD_MAGIC "smrec 1"
+
+static const char* RECORD_NAMES[RECORD_TYPE_COUNT] = {
+    "item",
+    "size",
+    "fbsize",
+    "pos",
+    "scroll",
+    "click",
+    "key",
+    "char",
+    "frame",
+};
+
+/*  Number of integer and float arguments for each event type */
+static const int RECORD_ARGS[RECORD_TYPE_COUNT][2] = {
+    {2, 0},
+    {2, 0},
+    {2, 0},
+    {0, 2},
+    {0, 2},
+    {3, 0},
+    {4, 0},
+    {1, 0},
+    {0, 0},
+};
+
+struct record_ {
+    FILE* file;
+    int64_t start_ns;
+    unsigned line;
+
+    /*  One event of lookahead, filled by record_peek */
+    bool has_peek;
+    record_event_t peek;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+record_t* record_new(const char* filename, bool write) {
+    FILE* file = fopen(filename, write ? "w" : "r");
+    if (!file) {
+        log_error("Could not open %s", filename);
+        return NULL;
+    }
+
+    OBJECT_ALLOC(record);
+    record->file = file;
+    record->start_ns = platform_get_time_ns();
+
+    char header[16];
+    if (write) {
+        fprintf(file, RECORD_MAGIC "\n");
+    } else if (!fgets(header, sizeof(header), file) ||
+               strcmp(header, RECORD_MAGIC "\n"))
+    {
+        log_error("%s is not a recording", filename);
+        record_delete(record);
+        return NULL;
+    }
+    record->line = 1;
+    return record;
+}
+
+void record_delete(record_t* record) {
+    fclose(record->file);
+    free(record);
+}
+
+void record_write(record_t* record, record_event_t event) {
+    const int64_t dt_ns = platform_get_time_ns() - record->start_ns;
+    fprintf(record->file, "%lli %s", (long long)(dt_ns / 1000),
+            RECORD_NAMES[event.type]);
+    for (int i=0; i < RECORD_ARGS[event.type][0]; ++i) {
+        fprintf(record->file, " %i", event.i[i]);
+    }
+    for (int i=0; i < RECORD_ARGS[event.type][1]; ++i) {
+        fprintf(record->file, " %.9g", event.f[i]);
+    }
+    fprintf(record->file, "\n");
+}
+
+bool record_peek(record_t* record, record_event_t* event) {
+    if (!record->has_peek) {
+        if (!record_read(record, &record->peek)) {
+            return false;
+        }
+        record->has_peek = true;
+    }
+    *event = record->peek;
+    return true;
+}
+
+bool record_read(record_t* record, record_event_t* event) {
+    if (record->has_peek) {
+        *event = record->peek;
+        record->has_peek = false;
+        return true;
+    }
+
+    char line[128];
+    if (!fgets(line, sizeof(line), record->file)) {
+        return false;
+    }
+    record->line++;
+    memset(event, 0, sizeof(*event));
+
+    long long t;
+    int n;
+    char name[16];
+    if (sscanf(line, "%lli %15s%n", &t, name, &n) != 2) {
+        log_error_and_abort("Malformed recording at line %u", record->line);
+    }
+    event->time_us = t;
+
+    event->type = RECORD_TYPE_COUNT;
+    for (unsigned i=0; i < RECORD_TYPE_COUNT; ++i) {
+        if (!strcmp(name, RECORD_NAMES[i])) {
+            event->type = i;
+        }
+    }
+    if (event->type == RECORD_TYPE_COUNT) {
+        log_error_and_abort("Unknown event '%s' at line %u",
+                            name, record->line);
+    }
+
+    const char* s = line + n;
+    for (int i=0; i < RECORD_ARGS[event->type][0]; ++i) {
+        if (sscanf(s, " %i%n", &event->i[i], &n) != 1) {
+            log_error_and_abort("Missing argument at line %u", record->line);
+        }
+        s += n;
+    }
+    for (int i=0; i < RECORD_ARGS[event->type][1]; ++i) {
+        if (sscanf(s, " %f%n", &event->f[i], &n) != 1) {
+            log_error_and_abort("Missing argument at line %u", record->line);
+        }
+        s += n;
+    }
+    return true;
+}
@@ -0,0 +1,111 @@
+#include "instance.h"
+#include "log.h"
+#include "platform.h"
+#include "record.h"
+#include "replay.h"
+
+static int replay_cmp(const void* a, const void* b) {
+    const int64_t x = *(const int64_t*)a;
+    const int64_t y = *(const int64_t*)b;
+    return (x > y) - (x < y);
+}
+
+/*  Prints a summary line, with all times in milliseconds */
+static void replay_report(int64_t startup_ns, int64_t* frames, size_t count) {
+    printf("startup_ms %.3f\n", startup_ns / 1e6);
+    if (!count) {
+        printf("frames 0\n");
+        return;
+    }
+    qsort(frames, count, sizeof(int64_t), replay_cmp);
+    int64_t total = 0;
+    for (size_t i=0; i < count; ++i) {
+        total += frames[i];
+    }
+    printf("frames %zu\n", count);
+    printf("frame_mean_ms %.3f\n", total / (double)count / 1e6);
+    printf("frame_p50_ms %.3f\n", frames[count / 2] / 1e6);
+    printf("frame_p99_ms %.3f\n", frames[count * 99 / 100] / 1e6);
+    printf("frame_max_ms %.3f\n", frames[count - 1] / 1e6);
+}
+
+bool replay_run(const char* filename) {
+    record_t* replay = record_new(filename, false);
+    if (!replay) {
+        return false;
+    }
+
+    /*  Use an in-memory database, so that replays are repeatable
+     *  and don't touch the user's progress */
+    const instance_config_t config = {
+        .db_path = ":memory:",
+        .headless = true,
+        .replay = replay,
+    };
+    const int64_t start_ns = platform_get_time_ns();
+    instance_t* instance = instance_new(&config);
+    const int64_t startup_ns = platform_get_time_ns() - start_ns;
+    glfwSwapInterval(0);
+
+    size_t count = 0;
+    size_t capacity = 1024;
+    int64_t* frames = malloc(capacity * sizeof(int64_t));
+
+    unsigned skipped = 0;
+    record_event_t e;
+    while (record_read(replay, &e)) {
+        switch (e.type) {
+            case RECORD_WINDOW_SIZE:
+                instance_cb_window_size(instance, e.i[0], e.i[1]);
+                break;
+            case RECORD_FB_SIZE:
+                instance_cb_framebuffer_size(instance, e.i[0], e.i[1]);
+                break;
+            case RECORD_MOUSE_POS:
+                instance_queue_mouse_pos(instance, e.f[0], e.f[1]);
+                break;
+            case RECORD_SCROLL:
+                instance_queue_mouse_scroll(instance, e.f[0], e.f[1]);
+                break;
+            case RECORD_CLICK:
+                instance_cb_mouse_click(instance, e.i[0], e.i[1], e.i[2]);
+                break;
+            case RECORD_KEY:
+                instance_cb_key(instance, e.i[0], e.i[1], e.i[2], e.i[3]);
+                break;
+            case RECORD_CHAR:
+                instance_cb_char(instance, e.i[0]);
+                break;
+            case RECORD_FRAME: {
+                /*  Wait for the GPU, so that frame times include its work */
+                const int64_t t0 = platform_get_time_ns();
+                instance_draw(instance);
+                glFinish();
+                if (count == capacity) {
+                    capacity *= 2;
+                    frames = realloc(frames, capacity * sizeof(int64_t));
+                }
+                frames[count++] = platform_get_time_ns() - t0;
+                break;
+            }
+            case RECORD_ITEM:
+                /*  Items are normally consumed by instance_next, so this
+                 *  means that the replay has diverged.  That's expected
+                 *  for synthetic recordings (which can't know the outcome
+                 *  of every click), so keep going. */
+                skipped++;
+                break;
+            case RECORD_TYPE_COUNT: break;
+        }
+    }
+
+    if (skipped) {
+        log_info("Skipped %u items which weren't reached in the replay",
+                 skipped);
+    }
+    replay_report(startup_ns, frames, count);
+    free(frames);
+    instance_delete(instance);
+    record_delete(replay);
+    return true;
+}
@@ -1,6 +1,16 @@
 #include "log.h"
+#include "platform.h"
 #include "shader.h"
 
+/*  Header for cached program binaries */
+#define SHADER_CACHE_MAGIC 0x53484452
+
+typedef struct {
+    uint32_t magic;
+    uint32_t format;
+    uint32_t size;
+} shader_cache_header_t;
+
 static GLuint shader_build(const GLchar* src, GLenum type) {
     const GLuint shader = glCreateShader(type);
     glShaderSource(shader, 1, &src, NULL);
@@ -21,10 +31,141 @@ static GLuint shader_build(const GLchar* src, GLenum type) {
     return shader;
 }
 
+/*  64-bit FNV-1a hash, used to key the program binary cache */
+static uint64_t shader_hash(uint64_t h, const char* s) {
+    while (s && *s) {
+        h ^= (uint8_t)*s++;
+        h *= 1099511628211ULL;
+    }
+    /*  Mix in a separator, so that ("ab", "c") and ("a", "bc") differ */
+    h ^= 0xFF;
+    h *= 1099511628211ULL;
+    return h;
+}
+
+/*  Returns the cache file for the given program sources, or NULL if
+ *  the driver doesn't support program binaries.  The key includes the
+ *  driver strings, so that driver updates invalidate the cache.  The
+ *  caller owns the returned string. */
+static char* shader_cache_path(const char* vs, const char* gs,
+                               const char* fs)
+{
+    if (!GLEW_VERSION_4_1 && !GLEW_ARB_get_program_binary) {
+        return NULL;
+    }
+    GLint formats = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+    if (formats <= 0) {
+        return NULL;
+    }
+
+    uint64_t h = 14695981039346656037ULL;
+    h = shader_hash(h, vs);
+    h = shader_hash(h, gs);
+    h = shader_hash(h, fs);
+    h = shader_hash(h, (const char*)glGetString(GL_VENDOR));
+    h = shader_hash(h, (const char*)glGetString(GL_RENDERER));
+    h = shader_hash(h, (const char*)glGetString(GL_VERSION));
+
+    char name[64];
+    snprintf(name, sizeof(name), "shader-%016llx.bin", (unsigned long long)h);
+    return platform_get_user_file(name);
+}
+
+/*  Attempts to load a cached binary into the given program.  Returns false
+ *  if the file is missing or the driver rejects the binary. */
+static bool shader_cache_load(GLuint prog, const char* path) {
+    FILE* f = fopen(path, "rb");
+    if (!f) {
+        return false;
+    }
+
+    /*  The binary must fill the rest of the file exactly, which rejects
+     *  truncated or corrupt files before allocating anything */
+    long file_size = -1;
+    if (!fseek(f, 0, SEEK_END)) {
+        file_size = ftell(f);
+        rewind(f);
+    }
+
+    bool ok = false;
+    shader_cache_header_t header;
+    if (fread(&header, sizeof(header), 1, f) == 1 &&
+        header.magic == SHADER_CACHE_MAGIC &&
+        header.size > 0 &&
+        file_size == (long)(sizeof(header) + header.size))
+    {
+        void* data = malloc(header.size);
+        if (data && fread(data, 1, header.size, f) == header.size) {
+            glProgramBinary(prog, header.format, data, header.size);
+            GLint status;
+            glGetProgramiv(prog, GL_LINK_STATUS, &status);
+            ok = (status == GL_TRUE);
+        }
+        free(data);
+    }
+    fclose(f);
+
+    if (!ok) {
+        log_warn("Rejected cached program binary %s", path);
+        /*  Clear any error raised by glProgramBinary */
+        while (glGetError() != GL_NO_ERROR);
+    }
+    return ok;
+}
+
+static void shader_cache_save(GLuint prog, const char* path) {
+    GLint len = 0;
+    glGetProgramiv(prog, GL_PROGRAM_BINARY_LENGTH, &len);
+    if (len <= 0) {
+        return;
+    }
+
+    void* data = malloc(len);
+    GLenum format;
+    glGetProgramBinary(prog, len, NULL, &format, data);
+
+    FILE* f = fopen(path, "wb");
+    if (f) {
+        shader_cache_header_t header = {
+            .magic = SHADER_CACHE_MAGIC,
+            .format = format,
+            .size = len,
+        };
+        if (fwrite(&header, sizeof(header), 1, f) != 1 ||
+            fwrite(data, 1, len, f) != (size_t)len)
+        {
+            log_warn("Failed to write program binary %s", path);
+        }
+        fclose(f);
+    } else {
+        log_warn("Could not open %s", path);
+    }
+    free(data);
+}
+
 shader_t shader_new(const char* vs, const char* gs, const char* fs) {
-    shader_t shader;
+    /*  Shaders are left as 0 if the program is loaded from the cache,
+     *  which is silently ignored by glDeleteShader. */
+    shader_t shader = {0};
+
+    char* cache = shader_cache_path(vs, gs, fs);
+    if (cache) {
+        shader.prog = glCreateProgram();
+        if (shader_cache_load(shader.prog, cache)) {
+            log_trace("Loaded cached program binary");
+            free(cache);
+            return shader;
+        }
+        /*  Start fresh, rather than relinking a failed program */
+        glDeleteProgram(shader.prog);
+    }
 
     shader.prog = glCreateProgram();
+    if (cache) {
+        glProgramParameteri(shader.prog, GL_PROGRAM_BINARY_RETRIEVABLE_HINT,
+                            GL_TRUE);
+    }
 
     shader.vs = shader_build(vs, GL_VERTEX_SHADER);
     glAttachShader(shader.prog, shader.vs);
@@ -48,6 +189,11 @@ shader_t shader_new(const char* vs, const char* gs, const char* fs) {
         glGetProgramInfoLog(shader.prog, len, NULL, buf);
         log_error_and_abort("Failed to link program: %s", buf);
     }
+
+    if (cache) {
+        shader_cache_save(shader.prog, cache);
+        free(cache);
+    }
     return shader;
 }
 
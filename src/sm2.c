@@ -3,6 +3,9 @@
 #include "object.h"
 #include "platform.h"
 #include "sm2.h"
+#include "states.h"
+#include "timing.h"
+#include "trace.h"
 
 #define SQLITE_CHECKED(cond) do {       \
     if ((cond) != SQLITE_OK) {          \
@@ -13,6 +16,13 @@
 struct sm2_ {
     sqlite3* db;
 
+    /* Active profile, which is bound into every statement below */
+    uint32_t profile;
+
+    /* Count and insert a profile's items */
+    sqlite3_stmt* count;
+    sqlite3_stmt* insert;
+
     /* Select a new random item to train on */
     sqlite3_stmt* selector;
 
@@ -27,6 +37,13 @@ struct sm2_ {
 
     /* Reschedule some number of days from now */
     sqlite3_stmt* reschedule;
+
+    /* Look up a single item's SM2 parameters */
+    sqlite3_stmt* find;
+
+    /* Group updates into a single transaction */
+    sqlite3_stmt* begin;
+    sqlite3_stmt* commit;
 };
 
 static void sm2_prepare_statement(sm2_t* sm2, sqlite3_stmt** ptr,
@@ -38,21 +55,53 @@ static void sm2_prepare_statement(sm2_t* sm2, sqlite3_stmt** ptr,
     }
 }
 
-/*  Binds the two item parameters */
+/*  Binds the two item parameters, plus the profile as ?4 */
 static void sm2_item_bind(sm2_t* sm2, sqlite3_stmt* s, sm2_item_t* item) {
     SQLITE_CHECKED(sqlite3_reset(s));
     SQLITE_CHECKED(sqlite3_bind_int(s, 1, item->mode));
-    SQLITE_CHECKED(sqlite3_bind_text(s, 2, item->state, -1, SQLITE_STATIC));
+    SQLITE_CHECKED(sqlite3_bind_text(s, 2, states_name(item->state), -1,
+                                     SQLITE_STATIC));
+    SQLITE_CHECKED(sqlite3_bind_int64(s, 4, sm2->profile));
 }
 
-sm2_t* sm2_new() {
-    OBJECT_ALLOC(sm2);
+/*  Adds any missing items for the active profile.  This uses a savepoint
+ *  rather than a transaction, so it can run within sm2_begin/commit. */
+static void sm2_populate(sm2_t* sm2) {
+    SQLITE_CHECKED(sqlite3_reset(sm2->count));
+    SQLITE_CHECKED(sqlite3_bind_int64(sm2->count, 1, sm2->profile));
+    if (sqlite3_step(sm2->count) != SQLITE_ROW) {
+        log_sqlite_error_and_abort();
+    }
+    const int count = sqlite3_column_int(sm2->count, 0);
+    if (count == STATES_COUNT * 2) {
+        return;
+    }
 
-    const char* p = platform_get_user_file("sm.sqlite");
-    if (p == NULL) {
-        log_error_and_abort("Could not open sm.sqlite");
+    /*  Populating a profile in one step avoids syncing to disk
+     *  after every row */
+    char* err_msg;
+    SQLITE_CHECKED(sqlite3_exec(sm2->db, "SAVEPOINT sm2_populate",
+                                NULL, NULL, &err_msg));
+    for (unsigned state=1; state <= STATES_COUNT; ++state) {
+        for (unsigned j=ITEM_MODE_POSITION; j <= ITEM_MODE_NAME; ++j) {
+            sm2_item_t item = (sm2_item_t){
+                .mode=j,
+                .state=state
+            };
+            sm2_item_bind(sm2, sm2->insert, &item);
+            if (sqlite3_step(sm2->insert) != SQLITE_DONE) {
+                log_sqlite_error_and_abort();
+            }
+        }
     }
-    SQLITE_CHECKED(sqlite3_open(p, &sm2->db));
+    SQLITE_CHECKED(sqlite3_exec(sm2->db, "RELEASE sm2_populate",
+                                NULL, NULL, &err_msg));
+}
+
+sm2_t* sm2_new(const char* path) {
+    TRACE_BEGIN("sm2_new");
+    OBJECT_ALLOC(sm2);
+    SQLITE_CHECKED(sqlite3_open(path, &sm2->db));
 
     char* err_msg;
     SQLITE_CHECKED(sqlite3_exec(sm2->db, "CREATE TABLE IF NOT EXISTS sm2 ("
@@ -60,68 +109,82 @@ sm2_t* sm2_new() {
                 "item TEXT NOT NULL,"
                 "ef REAL NOT NULL,"
                 "next INT,"
-                "reps INT"
+                "reps INT,"
+                "profile INTEGER NOT NULL DEFAULT 0"
                 ")", NULL, NULL, &err_msg));
 
-    sqlite3_stmt* check_if_present;
-    sm2_prepare_statement(sm2, &check_if_present,
-        "SELECT * FROM sm2 WHERE type = ?1 AND item = ?2");
+    /*  Databases from before profiles were added are upgraded in place,
+     *  with their existing items belonging to profile 0 */
+    sqlite3_stmt* check_profile;
+    if (sqlite3_prepare_v2(sm2->db, "SELECT profile FROM sm2 LIMIT 0",
+                           -1, &check_profile, NULL) == SQLITE_OK)
+    {
+        sqlite3_finalize(check_profile);
+    } else {
+        log_info("Adding profile column to database");
+        SQLITE_CHECKED(sqlite3_exec(sm2->db, "ALTER TABLE sm2 "
+                    "ADD COLUMN profile INTEGER NOT NULL DEFAULT 0",
+                    NULL, NULL, &err_msg));
+    }
 
-    sqlite3_stmt* insert_state;
-    sm2_prepare_statement(sm2, &insert_state,
-        "INSERT INTO sm2(type, item, ef, reps)"
-        "    VALUES (?1, ?2, 2.5, 0)");
+    /*  Items are found by (profile, type, item) when updating, and
+     *  scheduled items are picked by (profile, next).  Each profile's
+     *  index entries are contiguous (as are its rows, which are inserted
+     *  together), so work on one profile only touches its own pages. */
+    SQLITE_CHECKED(sqlite3_exec(sm2->db,
+                "CREATE UNIQUE INDEX IF NOT EXISTS sm2_profile_item"
+                "    ON sm2(profile, type, item);"
+                "CREATE INDEX IF NOT EXISTS sm2_profile_next"
+                "    ON sm2(profile, next)", NULL, NULL, &err_msg));
 
-    for (unsigned state=0; state < STATES_COUNT; ++state) {
-        for (unsigned j=ITEM_MODE_POSITION; j <= ITEM_MODE_NAME; ++j) {
-            sm2_item_t item = (sm2_item_t){
-                .mode=j,
-                .state=STATES_NAMES[state]
-            };
-            sm2_item_bind(sm2, check_if_present, &item);
-
-            const int r = sqlite3_step(check_if_present);
-            if (r == SQLITE_ROW) {
-                // The item is already inserted, keep going
-            } else if (r == SQLITE_DONE) {
-                sm2_item_bind(sm2, insert_state, &item);
-                if (sqlite3_step(insert_state) != SQLITE_DONE) {
-                    log_sqlite_error_and_abort();
-                }
-            } else {
-                log_sqlite_error_and_abort();
-            }
-        }
-    }
-    sqlite3_finalize(check_if_present);
-    sqlite3_finalize(insert_state);
+    sm2_prepare_statement(sm2, &sm2->count,
+        "SELECT COUNT(*) FROM sm2 WHERE profile = ?1");
+    sm2_prepare_statement(sm2, &sm2->insert,
+        "INSERT OR IGNORE INTO sm2(profile, type, item, ef, reps)"
+        "    VALUES (?4, ?1, ?2, 2.5, 0)");
+    sm2_populate(sm2);
 
     sm2_prepare_statement(sm2, &sm2->selector,
         "SELECT type, item, ef, reps FROM sm2"
-        "    WHERE next IS NULL OR next <= strftime('%s', 'now')"
+        "    WHERE profile = ?1 AND"
+        "          (next IS NULL OR next <= strftime('%s', 'now'))"
         "    ORDER BY RANDOM()"
         "    LIMIT 1");
     sm2_prepare_statement(sm2, &sm2->incorrect,
-        "UPDATE sm2 SET reps = 1 WHERE type = ?1 AND item = ?2");
+        "UPDATE sm2 SET reps = 1"
+        "    WHERE profile = ?4 AND type = ?1 AND item = ?2");
     sm2_prepare_statement(sm2, &sm2->correct,
-        "UPDATE sm2 SET ef = ?3 WHERE type = ?1 AND item = ?2");
+        "UPDATE sm2 SET ef = ?3"
+        "    WHERE profile = ?4 AND type = ?1 AND item = ?2");
     sm2_prepare_statement(sm2, &sm2->retrain,
-        "UPDATE sm2 SET next = NULL WHERE type = ?1 AND item = ?2");
+        "UPDATE sm2 SET next = NULL"
+        "    WHERE profile = ?4 AND type = ?1 AND item = ?2");
     sm2_prepare_statement(sm2, &sm2->reschedule,
         "UPDATE sm2"
         "    SET reps = reps + 1, "
         "        next = strftime('%s', 'now') + ?3 * 86400.0 - 86400.0/2"
-        "    WHERE type = ?1 AND item = ?2");
+        "    WHERE profile = ?4 AND type = ?1 AND item = ?2");
+    sm2_prepare_statement(sm2, &sm2->find,
+        "SELECT ef, reps FROM sm2"
+        "    WHERE profile = ?4 AND type = ?1 AND item = ?2");
+    sm2_prepare_statement(sm2, &sm2->begin, "BEGIN");
+    sm2_prepare_statement(sm2, &sm2->commit, "COMMIT");
 
+    TRACE_END("sm2_new");
     return sm2;
 }
 
 void sm2_delete(sm2_t* sm2) {
+    sqlite3_finalize(sm2->count);
+    sqlite3_finalize(sm2->insert);
     sqlite3_finalize(sm2->selector);
     sqlite3_finalize(sm2->incorrect);
     sqlite3_finalize(sm2->correct);
     sqlite3_finalize(sm2->retrain);
     sqlite3_finalize(sm2->reschedule);
+    sqlite3_finalize(sm2->find);
+    sqlite3_finalize(sm2->begin);
+    sqlite3_finalize(sm2->commit);
     if (sqlite3_close(sm2->db) != SQLITE_OK) {
         log_error("Could not close database while deleting sm2");
     }
@@ -130,19 +193,24 @@ void sm2_delete(sm2_t* sm2) {
 
 /*  Picks a random item that's scheduled for learning */
 sm2_item_t* sm2_next(sm2_t* sm2) {
+    TRACE_BEGIN("sm2_next");
+    TIMING_BEGIN(sm2_next);
     sm2_item_t* out = calloc(sizeof(sm2_item_t), 1);
     sqlite3_reset(sm2->selector);
+    SQLITE_CHECKED(sqlite3_bind_int64(sm2->selector, 1, sm2->profile));
     switch (sqlite3_step(sm2->selector)) {
         case SQLITE_ROW: {
             const int type = sqlite3_column_int(sm2->selector, 0);
-            const int len = sqlite3_column_bytes(sm2->selector, 1);
-            const unsigned char* txt = sqlite3_column_text(sm2->selector, 1);
+            const char* txt = (const char*)
+                sqlite3_column_text(sm2->selector, 1);
             const double ef = sqlite3_column_double(sm2->selector, 2);
             const int reps = sqlite3_column_int(sm2->selector, 3);
 
-            // The item must own its own string
-            char* state = malloc(len + 1);
-            memcpy(state, txt, len + 1);
+            // Items are stored by name, so convert back to an ID
+            const unsigned state = states_lookup(txt);
+            if (!state) {
+                log_error_and_abort("Could not find state %s", txt);
+            }
 
             *out = (sm2_item_t){
                 .state = state,
@@ -158,12 +226,61 @@ sm2_item_t* sm2_next(sm2_t* sm2) {
         }
         default: log_sqlite_error_and_abort();
     };
+    TIMING_END(sm2_next);
+    TRACE_END("sm2_next");
     return out;
 }
 
+void sm2_set_profile(sm2_t* sm2, uint32_t profile) {
+    if (profile != sm2->profile) {
+        TRACE_BEGIN("sm2_set_profile");
+        sm2->profile = profile;
+        sm2_populate(sm2);
+        TRACE_END("sm2_set_profile");
+    }
+}
+
+sm2_item_t* sm2_find(sm2_t* sm2, unsigned state, int mode) {
+    if (!state || state > STATES_COUNT ||
+        mode < ITEM_MODE_POSITION || mode > ITEM_MODE_NAME)
+    {
+        return NULL;
+    }
+    sm2_item_t item = (sm2_item_t){ .state = state, .mode = mode };
+    sm2_item_bind(sm2, sm2->find, &item);
+    switch (sqlite3_step(sm2->find)) {
+        case SQLITE_ROW: {
+            item.ef = sqlite3_column_double(sm2->find, 0);
+            item.reps = sqlite3_column_int(sm2->find, 1);
+            sm2_item_t* out = malloc(sizeof(sm2_item_t));
+            *out = item;
+            return out;
+        }
+        case SQLITE_DONE: return NULL;
+        default: log_sqlite_error_and_abort();
+    }
+    return NULL;
+}
+
+void sm2_begin(sm2_t* sm2) {
+    SQLITE_CHECKED(sqlite3_reset(sm2->begin));
+    if (sqlite3_step(sm2->begin) != SQLITE_DONE) {
+        log_sqlite_error_and_abort();
+    }
+}
+
+void sm2_commit(sm2_t* sm2) {
+    SQLITE_CHECKED(sqlite3_reset(sm2->commit));
+    if (sqlite3_step(sm2->commit) != SQLITE_DONE) {
+        log_sqlite_error_and_abort();
+    }
+}
+
 void sm2_update(sm2_t* sm2, sm2_item_t* item, int q) {
     /*  Implements the SM2 algorithm described at
      *  https://www.supermemo.com/en/archives1990-2015/english/ol/sm2 */
+    TRACE_BEGIN("sm2_update");
+    TIMING_BEGIN(sm2_update);
     if (q < 3) {
         /* Reset the repetition count without changing EF */
         sm2_item_bind(sm2, sm2->incorrect, item);
@@ -197,9 +314,10 @@ void sm2_update(sm2_t* sm2, sm2_item_t* item, int q) {
             log_sqlite_error_and_abort();
         }
     }
+    TIMING_END(sm2_update);
+    TRACE_END("sm2_update");
 }
 
 void sm2_item_delete(sm2_item_t* item) {
-    free((void*)item->state);
     free(item);
 }
@@ -0,0 +1,33 @@
+#include "data.h"
+#include "log.h"
+#include "states.h"
+
+/*  Seeded FNV-1a, which must match fnv1a in data/gen.py */
+static uint32_t states_hash(uint32_t seed, const char* name) {
+    uint32_t h = 2166136261u ^ seed;
+    for (const unsigned char* c = (const unsigned char*)name; *c; ++c) {
+        h = (h ^ *c) * 16777619u;
+    }
+    return h;
+}
+
+unsigned states_lookup(const char* name) {
+    /*  The first hash picks a bucket, whose seed places the name
+     *  in a slot with no collisions.  Names which aren't states
+     *  still land in some slot, so check the name stored there. */
+    const uint32_t b = states_hash(0, name) % STATES_HASH_BUCKETS;
+    const uint32_t slot = states_hash(STATES_HASH_SEEDS[b], name)
+                        % STATES_HASH_SIZE;
+    const unsigned state = STATES_HASH_SLOTS[slot];
+    if (state && !strcmp(STATES_NAMES[state - 1], name)) {
+        return state;
+    }
+    return 0;
+}
+
+const char* states_name(unsigned state) {
+    if (!state || state > STATES_COUNT) {
+        log_error_and_abort("Invalid state %u", state);
+    }
+    return STATES_NAMES[state - 1];
+}
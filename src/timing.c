@@ -0,0 +1,90 @@
+#include "log.h"
+#include "platform.h"
+#include "timing.h"
+
+/*  List of timings which have been recorded at least once */
+static timing_t* timings = NULL;
+static int64_t last_report = 0;
+
+static unsigned timing_bucket(int64_t dt_ns) {
+    unsigned b = 0;
+    while (dt_ns > 1 && b < TIMING_BUCKETS - 1) {
+        dt_ns >>= 1;
+        b++;
+    }
+    return b;
+}
+
+void timing_record(timing_t* timing, int64_t dt_ns) {
+    if (dt_ns < 0) {
+        dt_ns = 0;
+    }
+    if (!__atomic_exchange_n(&timing->registered, true, __ATOMIC_ACQ_REL)) {
+        timing->next = __atomic_load_n(&timings, __ATOMIC_RELAXED);
+        while (!__atomic_compare_exchange_n(&timings, &timing->next, timing,
+                    true, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+    }
+
+    __atomic_fetch_add(&timing->count, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&timing->total_ns, dt_ns, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&timing->buckets[timing_bucket(dt_ns)], 1,
+                       __ATOMIC_RELAXED);
+
+    int64_t max = __atomic_load_n(&timing->max_ns, __ATOMIC_RELAXED);
+    while (dt_ns > max && !__atomic_compare_exchange_n(&timing->max_ns, &max,
+                dt_ns, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+}
+
+/*  Returns the upper bound of the bucket containing the given percentile */
+static int64_t timing_percentile(const uint64_t* buckets, uint64_t count,
+                                 float p)
+{
+    const uint64_t target = ceilf(count * p);
+    uint64_t seen = 0;
+    for (unsigned i=0; i < TIMING_BUCKETS; ++i) {
+        seen += buckets[i];
+        if (seen >= target) {
+            return 2LL << i;
+        }
+    }
+    return 2LL << (TIMING_BUCKETS - 1);
+}
+
+void timing_report(int64_t interval_ns) {
+    const int64_t now = platform_get_time_ns();
+    if (!last_report) {
+        last_report = now;
+    }
+    if (now - last_report < interval_ns) {
+        return;
+    }
+    last_report = now;
+
+    for (timing_t* t = __atomic_load_n(&timings, __ATOMIC_ACQUIRE);
+         t; t = t->next)
+    {
+        /*  Take a snapshot, resetting the shared counters as we go */
+        const uint64_t count = __atomic_exchange_n(&t->count, 0,
+                                                   __ATOMIC_RELAXED);
+        const int64_t total = __atomic_exchange_n(&t->total_ns, 0,
+                                                  __ATOMIC_RELAXED);
+        const int64_t max = __atomic_exchange_n(&t->max_ns, 0,
+                                                __ATOMIC_RELAXED);
+        uint64_t buckets[TIMING_BUCKETS];
+        uint64_t bucket_count = 0;
+        for (unsigned i=0; i < TIMING_BUCKETS; ++i) {
+            buckets[i] = __atomic_exchange_n(&t->buckets[i], 0,
+                                             __ATOMIC_RELAXED);
+            bucket_count += buckets[i];
+        }
+        if (!count || !bucket_count) {
+            continue;
+        }
+        log_trace("%-16s n=%-6llu mean %8.3f ms  p50 < %8.3f ms  "
+                  "p99 < %8.3f ms  max %8.3f ms", t->name,
+                  (unsigned long long)count, total / (double)count / 1e6,
+                  timing_percentile(buckets, bucket_count, 0.5f) / 1e6,
+                  timing_percentile(buckets, bucket_count, 0.99f) / 1e6,
+                  max / 1e6);
+    }
+}
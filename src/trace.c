@@ -0,0 +1,118 @@
+#include "log.h"
+#include "platform.h"
+#include "trace.h"
+
+/*  Events are recorded into per-thread chunks, so recording never takes
+ *  a lock.  Chunks are only allocated when a thread starts tracing or
+ *  fills up its current chunk. */
+#define TRACE_CHUNK_EVENTS 16384
+
+typedef struct {
+    const char* name;
+    int64_t time_ns;
+    char phase;
+} trace_event_t;
+
+typedef struct trace_chunk_ {
+    trace_event_t events[TRACE_CHUNK_EVENTS];
+    unsigned count;
+    struct trace_chunk_* next;
+} trace_chunk_t;
+
+typedef struct trace_thread_ {
+    unsigned tid;
+    trace_chunk_t* head;
+    trace_chunk_t* tail;
+    struct trace_thread_* next;
+} trace_thread_t;
+
+/*  Global list of threads which have recorded events */
+static trace_thread_t* threads = NULL;
+static unsigned thread_count = 0;
+static platform_mutex_t* threads_mutex = NULL;
+
+static __thread trace_thread_t* local = NULL;
+
+static trace_thread_t* trace_thread(void) {
+    if (!local) {
+        /*  The mutex is created lazily, so install it atomically in case
+         *  two threads start tracing at the same time. */
+        if (!__atomic_load_n(&threads_mutex, __ATOMIC_ACQUIRE)) {
+            platform_mutex_t* m = platform_mutex_new();
+            platform_mutex_t* expected = NULL;
+            if (!__atomic_compare_exchange_n(&threads_mutex, &expected, m,
+                    false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+            {
+                platform_mutex_delete(m);
+            }
+        }
+
+        local = calloc(1, sizeof(trace_thread_t));
+        local->head = calloc(1, sizeof(trace_chunk_t));
+        local->tail = local->head;
+
+        platform_mutex_lock(threads_mutex);
+        local->tid = ++thread_count;
+        local->next = threads;
+        threads = local;
+        platform_mutex_unlock(threads_mutex);
+    }
+    return local;
+}
+
+static void trace_record(const char* name, char phase) {
+    trace_thread_t* t = trace_thread();
+    if (t->tail->count == TRACE_CHUNK_EVENTS) {
+        t->tail->next = calloc(1, sizeof(trace_chunk_t));
+        t->tail = t->tail->next;
+    }
+    trace_event_t* e = &t->tail->events[t->tail->count++];
+    e->name = name;
+    e->phase = phase;
+    e->time_ns = platform_get_time_ns();
+}
+
+void trace_begin(const char* name) {
+    trace_record(name, 'B');
+}
+
+void trace_end(const char* name) {
+    trace_record(name, 'E');
+}
+
+bool trace_flush(const char* filename) {
+    FILE* out = filename ? fopen(filename, "w") : NULL;
+    if (!out) {
+        log_error("Could not open trace file %s",
+                  filename ? filename : "(null)");
+        return false;
+    }
+
+    fprintf(out, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+    bool first = true;
+    if (threads_mutex) {
+        platform_mutex_lock(threads_mutex);
+    }
+    for (trace_thread_t* t=threads; t; t = t->next) {
+        for (trace_chunk_t* c=t->head; c; c = c->next) {
+            for (unsigned i=0; i < c->count; ++i) {
+                const trace_event_t* e = &c->events[i];
+                /*  Timestamps are in microseconds, with fractions */
+                fprintf(out, "%s\n{\"name\":\"%s\",\"ph\":\"%c\","
+                             "\"ts\":%lli.%03i,\"pid\":1,\"tid\":%u}",
+                        first ? "" : ",", e->name, e->phase,
+                        (long long)(e->time_ns / 1000),
+                        (int)(e->time_ns % 1000), t->tid);
+                first = false;
+            }
+        }
+    }
+    if (threads_mutex) {
+        platform_mutex_unlock(threads_mutex);
+    }
+    fprintf(out, "\n]}\n");
+    fclose(out);
+
+    log_info("Wrote trace to %s", filename);
+    return true;
+}
@@ -0,0 +1,143 @@
+#include "log.h"
+#include "object.h"
+#include "trie.h"
+
+/*  Maximum prefix length tracked by the cursor.  Characters beyond this
+ *  are only counted (as a dead end), so that pops stay balanced. */
+#define TRIE_MAX_DEPTH 64
+
+/*  Marks a dead end on the cursor stack */
+#define TRIE_DEAD UINT32_MAX
+
+/*  Children are stored as a linked list through next, with 0 as the
+ *  terminator (node 0 is the root, so it's never a child). */
+typedef struct {
+    char c;
+    uint32_t child;
+    uint32_t next;
+
+    /*  Number of names below this node, and the shortest one */
+    uint32_t count;
+    uint32_t best;
+} trie_node_t;
+
+struct trie_ {
+    const char** names;
+
+    trie_node_t* nodes;
+    uint32_t node_count;
+
+    /*  Cursor stack, where stack[0] is always the root */
+    uint32_t stack[TRIE_MAX_DEPTH + 1];
+    unsigned depth;
+    unsigned overflow;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+static char trie_fold(char c) {
+    return (c >= 'A' && c <= 'Z') ? (c - 'A' + 'a') : c;
+}
+
+static uint32_t trie_find_child(const trie_t* trie, uint32_t n, char c) {
+    for (uint32_t i = trie->nodes[n].child; i; i = trie->nodes[i].next) {
+        if (trie->nodes[i].c == c) {
+            return i;
+        }
+    }
+    return 0;
+}
+
+/*  Records a name in the node's count and best completion */
+static void trie_node_add(trie_t* trie, uint32_t n, uint32_t name) {
+    trie_node_t* node = &trie->nodes[n];
+    if (!node->count ||
+        strlen(trie->names[name]) < strlen(trie->names[node->best]))
+    {
+        node->best = name;
+    }
+    node->count++;
+}
+
+trie_t* trie_new(const char** names, unsigned count) {
+    OBJECT_ALLOC(trie);
+    trie->names = names;
+
+    uint32_t capacity = 64;
+    trie->nodes = calloc(capacity, sizeof(trie_node_t));
+    trie->node_count = 1;
+
+    for (unsigned i=0; i < count; ++i) {
+        uint32_t n = 0;
+        trie_node_add(trie, n, i);
+        for (const char* s = names[i]; *s; ++s) {
+            const char c = trie_fold(*s);
+            uint32_t next = trie_find_child(trie, n, c);
+            if (!next) {
+                if (trie->node_count == capacity) {
+                    capacity *= 2;
+                    trie->nodes = realloc(trie->nodes,
+                                          capacity * sizeof(trie_node_t));
+                }
+                next = trie->node_count++;
+                trie->nodes[next] = (trie_node_t){
+                    .c = c,
+                    .next = trie->nodes[n].child,
+                };
+                trie->nodes[n].child = next;
+            }
+            n = next;
+            trie_node_add(trie, n, i);
+        }
+    }
+    log_trace("Built trie with %u nodes", trie->node_count);
+    return trie;
+}
+
+void trie_delete(trie_t* trie) {
+    free(trie->nodes);
+    free(trie);
+}
+
+void trie_reset(trie_t* trie) {
+    trie->depth = 0;
+    trie->overflow = 0;
+    trie->stack[0] = 0;
+}
+
+void trie_push(trie_t* trie, char c) {
+    if (trie->depth == TRIE_MAX_DEPTH) {
+        trie->overflow++;
+        return;
+    }
+    const uint32_t n = trie->stack[trie->depth];
+    uint32_t next = TRIE_DEAD;
+    if (n != TRIE_DEAD) {
+        next = trie_find_child(trie, n, trie_fold(c));
+        if (!next) {
+            next = TRIE_DEAD;
+        }
+    }
+    trie->stack[++trie->depth] = next;
+}
+
+void trie_pop(trie_t* trie) {
+    if (trie->overflow) {
+        trie->overflow--;
+    } else if (trie->depth) {
+        trie->depth--;
+    }
+}
+
+unsigned trie_count(const trie_t* trie) {
+    const uint32_t n = trie->stack[trie->depth];
+    return (n == TRIE_DEAD || trie->overflow) ? 0 : trie->nodes[n].count;
+}
+
+const char* trie_completion(const trie_t* trie) {
+    const uint32_t n = trie->stack[trie->depth];
+    if (n == TRIE_DEAD || trie->overflow) {
+        return "";
+    }
+    return trie->names[trie->nodes[n].best] + trie->depth;
+}
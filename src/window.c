@@ -1,32 +1,50 @@
 #include "instance.h"
 #include "log.h"
 #include "platform.h"
+#include "record.h"
 #include "window.h"
 
+/*  Saves an event if the instance is recording */
+static void window_record(instance_t* instance, record_event_t event) {
+    if (instance->record) {
+        record_write(instance->record, event);
+    }
+}
+
 static void cb_window_size(GLFWwindow* window, int width, int height) {
     instance_t* instance = (instance_t*)glfwGetWindowUserPointer(window);
+    window_record(instance, (record_event_t){
+        .type = RECORD_WINDOW_SIZE, .i = {width, height}});
     instance_cb_window_size(instance, width, height);
 }
 
 static void cb_framebuffer_size(GLFWwindow* window, int width, int height) {
     instance_t* instance = (instance_t*)glfwGetWindowUserPointer(window);
+    window_record(instance, (record_event_t){
+        .type = RECORD_FB_SIZE, .i = {width, height}});
     instance_cb_framebuffer_size(instance, width, height);
 }
 
 static void cb_mouse_pos(GLFWwindow* window, double x, double y) {
     instance_t* instance = (instance_t*)glfwGetWindowUserPointer(window);
-    instance_cb_mouse_pos(instance, x, y);
+    window_record(instance, (record_event_t){
+        .type = RECORD_MOUSE_POS, .f = {x, y}});
+    instance_queue_mouse_pos(instance, x, y);
 }
 
 static void cb_mouse_scroll(GLFWwindow* window, double dx, double dy) {
     instance_t* instance = (instance_t*)glfwGetWindowUserPointer(window);
-    instance_cb_mouse_scroll(instance, dx, dy);
+    window_record(instance, (record_event_t){
+        .type = RECORD_SCROLL, .f = {dx, dy}});
+    instance_queue_mouse_scroll(instance, dx, dy);
 }
 
 static void cb_mouse_click(GLFWwindow* window, int button,
                            int action, int mods)
 {
     instance_t* instance = (instance_t*)glfwGetWindowUserPointer(window);
+    window_record(instance, (record_event_t){
+        .type = RECORD_CLICK, .i = {button, action, mods}});
     instance_cb_mouse_click(instance, button, action, mods);
 }
 
@@ -34,12 +52,16 @@ static void cb_key(GLFWwindow* window, int key, int scancode,
                    int action, int mods)
 {
     instance_t* instance = (instance_t*)glfwGetWindowUserPointer(window);
+    window_record(instance, (record_event_t){
+        .type = RECORD_KEY, .i = {key, scancode, action, mods}});
     instance_cb_key(instance, key, scancode, action, mods);
 }
 
 static void cb_char(GLFWwindow* window, unsigned codepoint)
 {
     instance_t* instance = (instance_t*)glfwGetWindowUserPointer(window);
+    window_record(instance, (record_event_t){
+        .type = RECORD_CHAR, .i = {codepoint}});
     instance_cb_char(instance, codepoint);
 }
 
@@ -69,10 +91,12 @@ void window_bind(GLFWwindow* window, instance_t* instance) {
     platform_window_bind(window);
 }
 
-GLFWwindow* window_new(const char* filename, float width, float height) {
-    static bool first = true;
-
-    if (first) {
+GLFWwindow* window_new(const char* title, float width, float height,
+                       GLFWwindow* share)
+{
+    /*  Library setup only needs to happen for the first window, which is
+     *  the one that isn't sharing another window's objects */
+    if (!share) {
         if (!glfwInit()) {
             log_error_and_abort("Failed to initialize glfw");
         }
@@ -85,7 +109,7 @@ GLFWwindow* window_new(const char* filename, float width, float height) {
     }
 
     GLFWwindow* const window = glfwCreateWindow(
-            width, height, filename, NULL, NULL);
+            width, height, title, NULL, share);
     if (!window) {
         const char* err;
         glfwGetError(&err);
@@ -97,16 +121,15 @@ GLFWwindow* window_new(const char* filename, float width, float height) {
     glfwMakeContextCurrent(window);
     log_trace("Made context current");
 
-    if (first) {
+    if (!share) {
         const GLenum glew_err = glewInit();
         if (GLEW_OK != glew_err) {
             log_error_and_abort("GLEW initialization failed: %s",
                                 glewGetErrorString(glew_err));
         }
         log_trace("Initialized GLEW");
-        glClearDepth(1.0);
-        first = false;
     }
+    glClearDepth(1.0);
     return window;
 }
 
@@ -0,0 +1,134 @@
+# Decodes a binary log (written with --binary-log) into the same text format
+# that's normally printed to the terminal.
+#
+# Usage: python3 tools/log_decode.py log.bin
+import re
+import struct
+import sys
+
+MAGIC = b'smlog\0\0\1'
+SITE = 1
+MESSAGE = 2
+TYPES = ['TRACE', 'INFO', 'WARN', 'ERROR']
+
+# Matches a single printf conversion, capturing the pieces that Python's
+# %-formatting understands (so that length modifiers can be dropped)
+CONVERSION = re.compile(
+    r'%([-+ #0]*)(\*|\d+)?(?:\.(\*|\d*))?(hh|h|ll|l|j|z|t|L)?([diouxXeEfFgGaAcspn%])')
+
+def read(f, fmt):
+    size = struct.calcsize(fmt)
+    data = f.read(size)
+    if len(data) != size:
+        raise EOFError
+    return struct.unpack(fmt, data)
+
+def unpack_args(payload):
+    ''' Unpacks tagged arguments (see log_pack in src/log.c)
+    '''
+    args = []
+    i = 0
+    while i < len(payload):
+        tag = payload[i:i + 1]
+        i += 1
+        if tag == b'i':
+            args.append(struct.unpack_from('<q', payload, i)[0])
+            i += 8
+        elif tag == b'u':
+            args.append(struct.unpack_from('<Q', payload, i)[0])
+            i += 8
+        elif tag == b'f':
+            args.append(struct.unpack_from('<d', payload, i)[0])
+            i += 8
+        elif tag == b's':
+            (n,) = struct.unpack_from('<H', payload, i)
+            i += 2
+            args.append(payload[i:i + n].decode('utf-8', 'replace'))
+            i += n
+        else:
+            raise ValueError('Unknown argument tag %r' % tag)
+    return args
+
+def format_message(fmt, args):
+    ''' Formats a C format string with Python's % operator, converting each
+        conversion into its nearest Python equivalent.  If arguments were
+        dropped (because they didn't fit in the record), they're shown as ?
+    '''
+    out = []
+    pos = 0
+    args = list(args)
+    def take():
+        return args.pop(0) if args else None
+    for m in CONVERSION.finditer(fmt):
+        out.append(fmt[pos:m.start()])
+        pos = m.end()
+        flags, width, precision, _, conv = m.groups()
+        if conv == '%':
+            out.append('%')
+            continue
+        elif conv == 'n':
+            continue
+
+        spec = flags
+        values = []
+        if width == '*':
+            values.append(take())
+        if width:
+            spec += width
+        if precision is not None:
+            if precision == '*':
+                values.append(take())
+            spec += '.' + precision
+        value = take()
+
+        if None in values or value is None:
+            out.append('?')
+            continue
+        if conv in 'iu':
+            conv = 'd'
+        elif conv == 'p':
+            conv = 'x'
+            spec = '#' + spec
+        elif conv in 'aA':
+            conv = 's'
+            value = float.hex(value)
+        elif conv == 'c':
+            value = chr(value & 0xFF)
+        out.append(('%' + spec + conv) % tuple(values + [value]))
+    out.append(fmt[pos:])
+    return ''.join(out)
+
+def decode(f, out):
+    if f.read(len(MAGIC)) != MAGIC:
+        raise ValueError('Not a binary log file')
+    read(f, '<q')  # Start time, which messages are relative to
+
+    sites = {}
+    while True:
+        try:
+            (kind,) = read(f, '<B')
+            if kind == SITE:
+                (i, t, line, n) = read(f, '<IBIH')
+                filename = f.read(n).decode('utf-8')
+                (n,) = read(f, '<H')
+                fmt = f.read(n).decode('utf-8', 'replace')
+                sites[i] = (t, filename, line, fmt)
+            elif kind == MESSAGE:
+                (i, time, n) = read(f, '<IqH')
+                payload = f.read(n)
+                (t, filename, line, fmt) = sites[i]
+                out.write('[%s] (%u.%06u) %s:%i | %s\n' % (
+                    TYPES[t] if t < len(TYPES) else t,
+                    time // 1000000, time % 1000000,
+                    filename, line,
+                    format_message(fmt, unpack_args(payload))))
+            else:
+                raise ValueError('Unknown record type %i' % kind)
+        except EOFError:
+            break
+
+if __name__ == '__main__':
+    if len(sys.argv) != 2:
+        sys.exit('Usage: %s log.bin' % sys.argv[0])
+    with open(sys.argv[1], 'rb') as f:
+        decode(f, sys.stdout)
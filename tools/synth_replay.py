@@ -0,0 +1,151 @@
+# Generates a synthetic recording for --replay (see src/record.c), which
+# is used as the training run for 'make pgo'.  The session alternates
+# between finding states on the map (with lots of mouse motion, panning
+# and zooming) and typing state names (with typos and autocompletion).
+#
+# Usage: python3 tools/synth_replay.py [--seed N] [--questions N] > out.rec
+import argparse
+import os
+import random
+import re
+
+# Constants from GLFW
+PRESS, RELEASE = 1, 0
+KEY_ENTER, KEY_TAB, KEY_BACKSPACE = 257, 258, 259
+MODE_POSITION, MODE_NAME = 1, 2
+
+WIDTH, HEIGHT = 500, 500
+FRAME_US = 16667
+
+def state_names():
+    ''' Reads the state names from data/data.c, in ID order
+    '''
+    path = os.path.join(os.path.dirname(__file__), '..', 'data', 'data.c')
+    src = open(path).read()
+    block = src[src.index('STATES_NAMES[]'):]
+    block = block[:block.index('};')]
+    return re.findall(r'"([^"]*)"', block)
+
+class Recording:
+    def __init__(self):
+        self.t = 0
+        self.x, self.y = WIDTH / 2, HEIGHT / 2
+        print('smrec 1')
+
+    def event(self, name, *args):
+        self.t += random.randint(100, 2000)
+        print(' '.join([str(self.t), name] + [str(a) for a in args]))
+
+    def frame(self):
+        self.t += FRAME_US
+        self.event('frame')
+
+    def move(self, x, y, frames):
+        ''' Moves the mouse in a straight line, with several events per
+            frame (like a high-rate mouse)
+        '''
+        steps = frames * 4
+        (x0, y0) = (self.x, self.y)
+        for i in range(1, steps + 1):
+            self.x = x0 + (x - x0) * i / steps
+            self.y = y0 + (y - y0) * i / steps
+            self.event('pos', '%.2f' % self.x, '%.2f' % self.y)
+            if i % 4 == 0:
+                self.frame()
+
+    def random_point(self):
+        return (random.uniform(0, WIDTH), random.uniform(0, HEIGHT))
+
+    def click(self, drag=None):
+        self.event('click', 0, PRESS, 0)
+        self.frame()
+        if drag:
+            self.move(*drag, frames=random.randint(5, 20))
+        self.event('click', 0, RELEASE, 0)
+        self.frame()
+
+    def scroll(self, frames):
+        for i in range(frames):
+            for j in range(4):
+                self.event('scroll', 0, random.choice([-1, 1]))
+            self.frame()
+
+    def key(self, key):
+        self.event('key', key, 0, PRESS, 0)
+        self.event('key', key, 0, RELEASE, 0)
+        self.frame()
+
+    def type(self, text):
+        for c in text:
+            self.event('char', ord(c))
+            self.frame()
+
+    def answer(self, item):
+        ''' Grades the answer.  Only one of these keys is valid (depending
+            on whether the answer was right, which we can't know for map
+            clicks), so the next item is written after each of them.  The
+            item must immediately follow the key, since that's where the
+            replay looks for it; the replay skips whichever copy isn't used.
+
+            If the first key moves on to a name question, then the second
+            lands in its text field, so each key is followed by a backspace
+            (which does nothing elsewhere).
+        '''
+        for c in '25':
+            self.event('char', ord(c))
+            if item:
+                self.event('item', *item)
+            self.frame()
+            self.key(KEY_BACKSPACE)
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--seed', type=int, default=1)
+    parser.add_argument('--questions', type=int, default=60)
+    args = parser.parse_args()
+    random.seed(args.seed)
+
+    names = state_names()
+    items = [(MODE_POSITION if q % 2 == 0 else MODE_NAME,
+              random.randint(1, len(names))) for q in range(args.questions)]
+
+    # The first item is picked during startup, before any input
+    rec = Recording()
+    rec.event('item', *items[0])
+    rec.event('size', WIDTH, HEIGHT)
+    rec.event('fbsize', WIDTH, HEIGHT)
+
+    for (q, (mode, state)) in enumerate(items):
+        rec.frame()
+
+        if mode == MODE_POSITION:
+            for i in range(random.randint(2, 5)):
+                rec.move(*rec.random_point(), frames=random.randint(5, 30))
+            rec.scroll(random.randint(5, 20))
+            rec.click(drag=rec.random_point())
+            rec.scroll(random.randint(5, 20))
+            rec.move(*rec.random_point(), frames=10)
+            rec.click()
+        else:
+            name = names[state - 1]
+            r = random.random()
+            if r < 0.3:
+                # Type a prefix, then accept the autocompletion
+                rec.type(name[:random.randint(1, len(name))])
+                rec.key(KEY_TAB)
+            elif r < 0.6:
+                # Type with a typo, then fix it
+                i = random.randint(1, len(name) - 1)
+                rec.type(name[:i] + 'x')
+                rec.key(KEY_BACKSPACE)
+                rec.type(name[i:])
+            else:
+                # Type a different (wrong) name
+                rec.type(random.choice(names))
+            rec.key(KEY_ENTER)
+        for i in range(random.randint(5, 30)):
+            rec.frame()
+        rec.answer(items[q + 1] if q + 1 < len(items) else None)
+
+if __name__ == '__main__':
+    main()